@@ -0,0 +1,1099 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Standalone throughput benchmark for the division paths and the routines built on them.
+// It needs nothing but the headers, e.g. from the root of the repository:
+//
+//     g++ -std=c++14 -O2 -DNDEBUG -Iinclude benchmark/benchmark_div.cpp -o benchmark_div
+//
+// Every case runs over the same pre-generated operands and reports the best of several passes
+// as nanoseconds per operation and millions of operations per second.
+// The division backend is chosen at compile time, so the alternatives are measured by building again with
+// -DBOOST_INT128_NO_INLINE_DIVQ (the builtin __udivti3/__umodti3 libcalls instead of divq on x86-64)
+// or -DBOOST_INT128_NO_BUILTIN_INT128 (the portable kernels). MSVC x64 builds take the div_mod_msvc path.
+
+#include <boost/int128.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+using boost::int128::uint128_t;
+using boost::int128::int128_t;
+
+constexpr std::size_t operand_count {1U << 14};
+constexpr int passes {7};
+
+std::mt19937_64 rng {42U};
+
+// Every case folds its results into this, and it is printed at the end so that nothing is optimized away
+std::uint64_t sink {};
+
+// A random value of exactly the given bit width, 1 <= bits <= 128
+uint128_t random_width(const int bits)
+{
+    uint128_t x {rng(), rng()};
+    x >>= 128 - bits;
+    x |= uint128_t{1U} << (bits - 1);
+    return x;
+}
+
+// A random magnitude of the given bit width, at most 127, with a random sign
+int128_t random_signed_width(const int bits)
+{
+    const auto magnitude {static_cast<int128_t>(random_width((std::min)(bits, 127)))};
+    return (rng() & 1U) == 0U ? magnitude : -magnitude;
+}
+
+std::uint64_t low_word(const std::uint64_t x) { return x; }
+std::uint64_t low_word(const uint128_t x) { return x.low; }
+std::uint64_t low_word(const int128_t x) { return static_cast<uint128_t>(x).low; }
+
+#ifdef __SIZEOF_INT128__
+
+using builtin_u128 = unsigned __int128;
+using builtin_i128 = __int128;
+
+std::uint64_t low_word(const builtin_u128 x) { return static_cast<std::uint64_t>(x); }
+std::uint64_t low_word(const builtin_i128 x) { return static_cast<std::uint64_t>(x); }
+
+builtin_u128 to_builtin(const uint128_t x) { return (static_cast<builtin_u128>(x.high) << 64U) | x.low; }
+builtin_i128 to_builtin(const int128_t x) { return static_cast<builtin_i128>(to_builtin(static_cast<uint128_t>(x))); }
+
+template <typename T>
+auto to_builtin(const std::vector<T>& values) -> std::vector<decltype(to_builtin(T{}))>
+{
+    std::vector<decltype(to_builtin(T{}))> result;
+    result.reserve(values.size());
+
+    for (const auto& value : values)
+    {
+        result.emplace_back(to_builtin(value));
+    }
+
+    return result;
+}
+
+#endif // __SIZEOF_INT128__
+
+template <typename Function>
+void measure(const char* name, const std::size_t operations, Function f)
+{
+    auto best {(std::numeric_limits<double>::max)()};
+
+    for (int pass {}; pass < passes; ++pass)
+    {
+        const auto start {std::chrono::steady_clock::now()};
+        sink += f();
+        const auto stop {std::chrono::steady_clock::now()};
+
+        best = (std::min)(best, std::chrono::duration<double, std::nano>(stop - start).count());
+    }
+
+    const auto ns_per_op {best / static_cast<double>(operations)};
+    std::printf("  %-40s %10.2f ns/op %10.4g Mop/s\n", name, ns_per_op, 1000.0 / ns_per_op);
+}
+
+// Applies op to every pair of operands
+template <typename T, typename U, typename Op>
+void measure_binary(const char* name, const std::vector<T>& lhs, const std::vector<U>& rhs, Op op)
+{
+    measure(name, lhs.size(), [&]()
+    {
+        std::uint64_t result {};
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            result += low_word(op(lhs[i], rhs[i]));
+        }
+        return result;
+    });
+}
+
+// Applies op to every operand
+template <typename T, typename Op>
+void measure_unary(const char* name, const std::vector<T>& values, Op op)
+{
+    measure(name, values.size(), [&]()
+    {
+        std::uint64_t result {};
+        for (const auto& value : values)
+        {
+            result += low_word(op(value));
+        }
+        return result;
+    });
+}
+
+void print_backend()
+{
+    #if defined(_M_AMD64) && !defined(__GNUC__) && !defined(__clang__) && _MSC_VER >= 1920
+    std::printf("Division backend: MSVC _udiv128 and div_mod_msvc\n");
+    #elif defined(BOOST_INT128_HAS_INLINE_DIVQ)
+    std::printf("Division backend: inline divq\n");
+    #elif defined(BOOST_INT128_HAS_INT128)
+    std::printf("Division backend: builtin 128-bit integer\n");
+    #else
+    std::printf("Division backend: portable\n");
+    #endif
+}
+
+// Operand sizes in bits: each class lands on one branch of operator/ and operator%
+struct size_class
+{
+    int dividend_bits;
+    int divisor_bits;
+};
+
+constexpr size_class division_classes[] {
+    {1, 1}, {32, 1}, {32, 16}, {32, 32},
+    {64, 1}, {64, 16}, {64, 32}, {64, 48}, {64, 64},
+    {96, 1}, {96, 16}, {96, 32}, {96, 48}, {96, 64}, {96, 96},
+    {128, 1}, {128, 16}, {128, 32}, {128, 48}, {128, 64}, {128, 80}, {128, 96}, {128, 112}, {128, 128},
+    {64, 128}
+};
+
+const char* division_path(const size_class& c)
+{
+    if (c.divisor_bits > c.dividend_bits)
+    {
+        return "dividend < divisor";
+    }
+    if (c.dividend_bits <= 64)
+    {
+        return "64/64";
+    }
+    if (c.divisor_bits <= 32)
+    {
+        return "half_word_div";
+    }
+    if (c.divisor_bits <= 64)
+    {
+        return "one_word_div";
+    }
+
+    return "knuth_div";
+}
+
+void benchmark_unsigned_division(const size_class& c)
+{
+    std::vector<uint128_t> lhs;
+    std::vector<uint128_t> rhs;
+
+    for (std::size_t i {}; i < operand_count; ++i)
+    {
+        lhs.emplace_back(random_width(c.dividend_bits));
+        rhs.emplace_back(random_width(c.divisor_bits));
+    }
+
+    std::printf("uint128_t %d / %d bits (%s)\n", c.dividend_bits, c.divisor_bits, division_path(c));
+
+    measure_binary("operator/", lhs, rhs, [](const uint128_t x, const uint128_t y) { return x / y; });
+    measure_binary("operator%", lhs, rhs, [](const uint128_t x, const uint128_t y) { return x % y; });
+    measure_binary("div", lhs, rhs, [](const uint128_t x, const uint128_t y)
+    {
+        const auto res {boost::int128::div(x, y)};
+        return res.quot + res.rem;
+    });
+
+    // The kernel behind this class, called directly
+    if (c.divisor_bits <= c.dividend_bits)
+    {
+        if (c.dividend_bits <= 64)
+        {
+            measure_binary("64/64 on the low words", lhs, rhs, [](const uint128_t x, const uint128_t y) { return x.low / y.low; });
+        }
+        else if (c.divisor_bits <= 32)
+        {
+            measure_binary("detail::half_word_div", lhs, rhs, [](const uint128_t x, const uint128_t y)
+            {
+                uint128_t quotient {};
+                boost::int128::detail::half_word_div(x, static_cast<std::uint32_t>(y.low), quotient);
+                return quotient;
+            });
+        }
+        else if (c.divisor_bits <= 64)
+        {
+            measure_binary("detail::one_word_div", lhs, rhs, [](const uint128_t x, const uint128_t y)
+            {
+                uint128_t quotient {};
+                boost::int128::detail::one_word_div(x, y.low, quotient);
+                return quotient;
+            });
+        }
+        else
+        {
+            measure_binary("detail::knuth_div", lhs, rhs, [](const uint128_t x, const uint128_t y) { return boost::int128::detail::knuth_div(x, y); });
+
+            #if defined(_M_AMD64) && !defined(__GNUC__) && !defined(__clang__) && _MSC_VER >= 1920
+            measure_binary("detail::impl::div_mod_msvc", lhs, rhs, [](const uint128_t x, const uint128_t y)
+            {
+                uint128_t remainder {};
+                return boost::int128::detail::impl::div_mod_msvc<false>(x, y, remainder);
+            });
+            #endif
+        }
+
+        #ifdef BOOST_INT128_HAS_INLINE_DIVQ
+        if (c.dividend_bits > 64)
+        {
+            measure_binary("detail::div_mod_divq", lhs, rhs, [](const uint128_t x, const uint128_t y)
+            {
+                uint128_t remainder {};
+                return boost::int128::detail::div_mod_divq(x, y, remainder) + remainder;
+            });
+        }
+        #endif
+    }
+
+    #ifdef __SIZEOF_INT128__
+    const auto builtin_lhs {to_builtin(lhs)};
+    const auto builtin_rhs {to_builtin(rhs)};
+
+    measure_binary("unsigned __int128 /", builtin_lhs, builtin_rhs, [](const builtin_u128 x, const builtin_u128 y) { return x / y; });
+    measure_binary("unsigned __int128 %", builtin_lhs, builtin_rhs, [](const builtin_u128 x, const builtin_u128 y) { return x % y; });
+    #endif
+}
+
+void benchmark_signed_division(const size_class& c)
+{
+    std::vector<int128_t> lhs;
+    std::vector<int128_t> rhs;
+
+    for (std::size_t i {}; i < operand_count; ++i)
+    {
+        lhs.emplace_back(random_signed_width(c.dividend_bits));
+        rhs.emplace_back(random_signed_width(c.divisor_bits));
+    }
+
+    std::printf("int128_t %d / %d bits, random signs\n", c.dividend_bits, c.divisor_bits);
+
+    measure_binary("operator/", lhs, rhs, [](const int128_t x, const int128_t y) { return x / y; });
+    measure_binary("operator%", lhs, rhs, [](const int128_t x, const int128_t y) { return x % y; });
+    measure_binary("div", lhs, rhs, [](const int128_t x, const int128_t y)
+    {
+        const auto res {boost::int128::div(x, y)};
+        return res.quot + res.rem;
+    });
+
+    #ifdef __SIZEOF_INT128__
+    const auto builtin_lhs {to_builtin(lhs)};
+    const auto builtin_rhs {to_builtin(rhs)};
+
+    measure_binary("__int128 /", builtin_lhs, builtin_rhs, [](const builtin_i128 x, const builtin_i128 y) { return x / y; });
+    measure_binary("__int128 %", builtin_lhs, builtin_rhs, [](const builtin_i128 x, const builtin_i128 y) { return x % y; });
+    #endif
+}
+
+void benchmark_division()
+{
+    for (const auto& c : division_classes)
+    {
+        benchmark_unsigned_division(c);
+    }
+
+    for (const auto& c : division_classes)
+    {
+        benchmark_signed_division(c);
+    }
+}
+
+// uint128_divider and int128_divider against operator/ with the same divisor every time
+void benchmark_divider()
+{
+    for (const auto divisor_bits : {16, 32, 48, 64, 96, 128})
+    {
+        std::vector<uint128_t> dividends;
+        for (std::size_t i {}; i < operand_count; ++i)
+        {
+            dividends.emplace_back(random_width(128));
+        }
+
+        const auto divisor {random_width(divisor_bits)};
+        const boost::int128::uint128_divider divider {divisor};
+
+        std::printf("uint128_t 128-bit dividends / invariant %d-bit divisor\n", divisor_bits);
+
+        measure_unary("operator/", dividends, [&](const uint128_t x) { return x / divisor; });
+        measure_unary("uint128_divider quotient", dividends, [&](const uint128_t x) { return divider.quotient(x); });
+        measure_unary("operator%", dividends, [&](const uint128_t x) { return x % divisor; });
+        measure_unary("uint128_divider remainder", dividends, [&](const uint128_t x) { return divider.remainder(x); });
+
+        #ifdef __SIZEOF_INT128__
+        const auto builtin_dividends {to_builtin(dividends)};
+        const auto builtin_divisor {to_builtin(divisor)};
+        measure_unary("unsigned __int128 /", builtin_dividends, [&](const builtin_u128 x) { return x / builtin_divisor; });
+        #endif
+    }
+
+    for (const auto divisor_bits : {32, 64, 127})
+    {
+        std::vector<int128_t> dividends;
+        for (std::size_t i {}; i < operand_count; ++i)
+        {
+            dividends.emplace_back(random_signed_width(127));
+        }
+
+        const auto divisor {random_signed_width(divisor_bits)};
+        const boost::int128::int128_divider divider {divisor};
+
+        std::printf("int128_t random sign dividends / invariant %d-bit divisor\n", divisor_bits);
+
+        measure_unary("operator/", dividends, [&](const int128_t x) { return x / divisor; });
+        measure_unary("int128_divider quotient", dividends, [&](const int128_t x) { return divider.quotient(x); });
+    }
+
+    // Compile time constant divisors
+    std::vector<uint128_t> dividends;
+    for (std::size_t i {}; i < operand_count; ++i)
+    {
+        dividends.emplace_back(random_width(128));
+    }
+
+    const uint128_t ten {10U};
+    const boost::int128::uint128_divider divide_by_ten {ten};
+
+    std::printf("uint128_t 128-bit dividends / 10\n");
+
+    measure_unary("operator/", dividends, [&](const uint128_t x) { return x / ten; });
+    measure_unary("uint128_divider quotient", dividends, [&](const uint128_t x) { return divide_by_ten.quotient(x); });
+    measure_unary("div_by<0, 10>", dividends, [](const uint128_t x) { return boost::int128::div_by<0U, 10U>(x); });
+}
+
+// barrett128 against operator% for the same even modulus every time, batched over the operands
+void benchmark_barrett()
+{
+    for (const auto modulus_bits : {32, 64, 96, 128})
+    {
+        std::vector<uint128_t> lows;
+        std::vector<uint128_t> highs;
+        for (std::size_t i {}; i < operand_count; ++i)
+        {
+            lows.emplace_back(random_width(128));
+            highs.emplace_back(random_width(128));
+        }
+
+        // An even modulus that is not a power of two
+        auto modulus {random_width(modulus_bits) & ~uint128_t{1U}};
+        modulus |= uint128_t{2U};
+        const boost::int128::barrett128 reducer {modulus};
+
+        std::printf("uint128_t 128-bit values mod an even %d-bit modulus\n", modulus_bits);
+
+        measure_unary("operator%", lows, [&](const uint128_t x) { return x % modulus; });
+        measure_unary("barrett128 reduce", lows, [&](const uint128_t x) { return reducer.reduce(x); });
+
+        #ifdef __SIZEOF_INT128__
+        const auto builtin_lows {to_builtin(lows)};
+        const auto builtin_modulus {to_builtin(modulus)};
+        measure_unary("unsigned __int128 %", builtin_lows, [&](const builtin_u128 x) { return x % builtin_modulus; });
+        #endif
+
+        measure_binary("detail::div_wide_words remainder", highs, lows, [&](const uint128_t high, const uint128_t low)
+        {
+            const std::uint64_t u[4] {low.low, low.high, high.low, high.high};
+            std::uint64_t q[4] {};
+            std::uint64_t r_high {};
+            std::uint64_t r_low {};
+            boost::int128::detail::div_wide_words(u, modulus.high, modulus.low, q, r_high, r_low);
+            return uint128_t{r_high, r_low};
+        });
+        measure_binary("barrett128 reduce_wide", highs, lows, [&](const uint128_t high, const uint128_t low) { return reducer.reduce_wide(high, low); });
+    }
+}
+
+// mulmod, powmod and invmod for 127-bit odd and even moduli, and montgomery128 for the odd one
+void benchmark_modular()
+{
+    // powmod and invmod take microseconds, so fewer operands keep the run short
+    constexpr std::size_t count {1U << 10};
+
+    for (const bool odd : {true, false})
+    {
+        auto modulus {random_width(127)};
+        modulus = odd ? (modulus | uint128_t{1U}) : (modulus & ~uint128_t{1U});
+
+        std::vector<uint128_t> lhs;
+        std::vector<uint128_t> rhs;
+        std::vector<uint128_t> exponents;
+        for (std::size_t i {}; i < count; ++i)
+        {
+            lhs.emplace_back(random_width(128) % modulus);
+            rhs.emplace_back(random_width(128) % modulus);
+            exponents.emplace_back(random_width(128));
+        }
+
+        std::printf("uint128_t modular arithmetic, %s 127-bit modulus\n", odd ? "odd" : "even");
+
+        measure_binary("mulmod", lhs, rhs, [&](const uint128_t a, const uint128_t b) { return boost::int128::mulmod(a, b, modulus); });
+        measure_binary("powmod, 128-bit exponent", lhs, exponents, [&](const uint128_t a, const uint128_t e) { return boost::int128::powmod(a, e, modulus); });
+        measure_unary("invmod", lhs, [&](const uint128_t a) { return boost::int128::invmod(a, modulus); });
+
+        if (odd)
+        {
+            const boost::int128::montgomery128 ctx {modulus};
+            measure_binary("montgomery128 mul", lhs, rhs, [&](const uint128_t a, const uint128_t b) { return ctx.mul(a, b); });
+            measure_binary("montgomery128 pow, 128-bit exponent", lhs, exponents, [&](const uint128_t a, const uint128_t e) { return ctx.pow(a, e); });
+        }
+    }
+}
+
+// Primality tests per second across the 64 to 128-bit range, for random odd values and for primes
+void benchmark_is_prime()
+{
+    constexpr std::size_t count {1U << 10};
+
+    for (const auto bits : {64, 80, 96, 112, 128})
+    {
+        std::vector<uint128_t> odd_values;
+        std::vector<uint128_t> primes;
+        for (std::size_t i {}; i < count; ++i)
+        {
+            odd_values.emplace_back(random_width(bits) | uint128_t{1U});
+
+            auto candidate {random_width(bits) | uint128_t{1U}};
+            while (!boost::int128::is_prime(candidate))
+            {
+                candidate = random_width(bits) | uint128_t{1U};
+            }
+            primes.emplace_back(candidate);
+        }
+
+        std::printf("is_prime on %d-bit values\n", bits);
+
+        measure_unary("random odd values", odd_values, [](const uint128_t x) { return static_cast<std::uint64_t>(boost::int128::is_prime(x)); });
+        measure_unary("primes", primes, [](const uint128_t x) { return static_cast<std::uint64_t>(boost::int128::is_prime(x)); });
+    }
+}
+
+// A random prime of exactly the given bit width
+uint128_t random_prime(const int bits)
+{
+    auto candidate {random_width(bits) | uint128_t{1U}};
+    while (!boost::int128::is_prime(candidate))
+    {
+        candidate = random_width(bits) | uint128_t{1U};
+    }
+
+    return candidate;
+}
+
+// factorize on products of primes of the given sizes; Pollard-Brent rho needs about sqrt(p) steps,
+// where p is the second largest factor, so the cost follows the smaller prime
+void benchmark_factorize()
+{
+    constexpr std::size_t count {32U};
+
+    struct factor_sizes
+    {
+        int small_bits;
+        int large_bits;
+    };
+
+    for (const auto& sizes : {factor_sizes{16, 48}, factor_sizes{32, 32}, factor_sizes{24, 103}, factor_sizes{32, 95}})
+    {
+        std::vector<uint128_t> values;
+        for (std::size_t i {}; i < count; ++i)
+        {
+            values.emplace_back(random_prime(sizes.small_bits) * random_prime(sizes.large_bits));
+        }
+
+        std::printf("factorize on a %d-bit prime times a %d-bit prime\n", sizes.small_bits, sizes.large_bits);
+
+        measure_unary("factorize", values, [](const uint128_t x) { return static_cast<std::uint64_t>(boost::int128::factorize(x).size()); });
+    }
+}
+
+// divexact against operator/ on exact multiples, and divides against x % d == 0 on arbitrary values
+void benchmark_exact_division()
+{
+    for (const auto divisor_bits : {32, 64, 96})
+    {
+        std::vector<uint128_t> divisors;
+        std::vector<uint128_t> multiples;
+        std::vector<uint128_t> values;
+        for (std::size_t i {}; i < operand_count; ++i)
+        {
+            const auto d {random_width(divisor_bits)};
+            divisors.emplace_back(d);
+            multiples.emplace_back(d * random_width(128 - divisor_bits));
+            values.emplace_back(random_width(128));
+        }
+
+        std::printf("uint128_t exact division by %d-bit divisors\n", divisor_bits);
+
+        measure_binary("operator/ on multiples", multiples, divisors, [](const uint128_t x, const uint128_t d) { return x / d; });
+        measure_binary("divexact on multiples", multiples, divisors, [](const uint128_t x, const uint128_t d) { return boost::int128::divexact(x, d); });
+        measure_binary("x % d == 0", values, divisors, [](const uint128_t x, const uint128_t d) { return static_cast<std::uint64_t>(x % d == 0U); });
+        measure_binary("divides", values, divisors, [](const uint128_t x, const uint128_t d) { return static_cast<std::uint64_t>(boost::int128::divides(d, x)); });
+    }
+}
+
+#ifdef BOOST_INT128_HAS_SPAN
+
+template <typename T>
+std::uint64_t checksum(const std::vector<T>& values)
+{
+    std::uint64_t result {};
+    for (const auto& value : values)
+    {
+        result += low_word(value);
+    }
+
+    return result;
+}
+
+// Whole arrays divided by one divisor: the span overloads against a scalar operator/ loop
+void benchmark_span_division()
+{
+    for (const auto divisor_bits : {32, 64, 96, 128})
+    {
+        std::vector<uint128_t> in;
+        std::vector<int128_t> signed_in;
+        for (std::size_t i {}; i < operand_count; ++i)
+        {
+            // Random widths, so that many dividends are below the wider divisors
+            in.emplace_back(random_width(1 + static_cast<int>(rng() % 128U)));
+            signed_in.emplace_back(random_signed_width(1 + static_cast<int>(rng() % 127U)));
+        }
+
+        const auto divisor {random_width(divisor_bits)};
+        const auto signed_divisor {random_signed_width(divisor_bits)};
+        std::vector<uint128_t> out(in.size());
+        std::vector<int128_t> signed_out(signed_in.size());
+
+        std::printf("arrays of random width dividends / one %d-bit divisor\n", divisor_bits);
+
+        measure("uint128_t operator/ loop", in.size(), [&]()
+        {
+            for (std::size_t i {}; i < in.size(); ++i)
+            {
+                out[i] = in[i] / divisor;
+            }
+            return checksum(out);
+        });
+        measure("uint128_t divide(span)", in.size(), [&]()
+        {
+            boost::int128::divide(in, divisor, out);
+            return checksum(out);
+        });
+        measure("int128_t operator/ loop", signed_in.size(), [&]()
+        {
+            for (std::size_t i {}; i < signed_in.size(); ++i)
+            {
+                signed_out[i] = signed_in[i] / signed_divisor;
+            }
+            return checksum(signed_out);
+        });
+        measure("int128_t divide(span)", signed_in.size(), [&]()
+        {
+            boost::int128::divide(signed_in, signed_divisor, signed_out);
+            return checksum(signed_out);
+        });
+    }
+}
+
+#endif // BOOST_INT128_HAS_SPAN
+
+// The rounding division family on random sign data against operator/ and operator% with the usual branchy correction
+void benchmark_rounding_division()
+{
+    for (const auto divisor_bits : {32, 64, 96})
+    {
+        std::vector<int128_t> lhs;
+        std::vector<int128_t> rhs;
+        for (std::size_t i {}; i < operand_count; ++i)
+        {
+            lhs.emplace_back(random_signed_width(127));
+            rhs.emplace_back(random_signed_width(divisor_bits));
+        }
+
+        std::printf("int128_t random signs, 127 / %d bits\n", divisor_bits);
+
+        measure_binary("operator/ with floor correction", lhs, rhs, [](const int128_t x, const int128_t y)
+        {
+            auto q {x / y};
+            const auto r {x % y};
+            if (r != 0 && ((r < 0) != (y < 0)))
+            {
+                --q;
+            }
+            return q;
+        });
+        measure_binary("div_floor", lhs, rhs, [](const int128_t x, const int128_t y) { return boost::int128::div_floor(x, y); });
+
+        measure_binary("operator/ with ceil correction", lhs, rhs, [](const int128_t x, const int128_t y)
+        {
+            auto q {x / y};
+            const auto r {x % y};
+            if (r != 0 && ((r < 0) == (y < 0)))
+            {
+                ++q;
+            }
+            return q;
+        });
+        measure_binary("div_ceil", lhs, rhs, [](const int128_t x, const int128_t y) { return boost::int128::div_ceil(x, y); });
+
+        measure_binary("operator% with euclid correction", lhs, rhs, [](const int128_t x, const int128_t y)
+        {
+            auto r {x % y};
+            if (r < 0)
+            {
+                r += y < 0 ? -y : y;
+            }
+            return r;
+        });
+        measure_binary("rem_euclid", lhs, rhs, [](const int128_t x, const int128_t y) { return boost::int128::rem_euclid(x, y); });
+        measure_binary("div_euclid", lhs, rhs, [](const int128_t x, const int128_t y) { return boost::int128::div_euclid(x, y); });
+        measure_binary("div_round_half_even", lhs, rhs, [](const int128_t x, const int128_t y) { return boost::int128::div_round_half_even(x, y); });
+    }
+}
+
+// Fixed point a * b / c with 18 implied decimals, against the bit_width overflow check followed by a * b / c
+void benchmark_muldiv()
+{
+    using boost::int128::rounding_mode;
+
+    const auto scale {static_cast<int128_t>(UINT64_C(1000000000000000000))};
+
+    struct operand_sizes
+    {
+        int a_bits;
+        int b_bits;
+        const char* description;
+    };
+
+    for (const auto& sizes : {operand_sizes{64, 60, "product fits into 128 bits"}, operand_sizes{96, 80, "product needs up to 176 bits"}})
+    {
+        std::vector<int128_t> lhs;
+        std::vector<int128_t> rhs;
+        for (std::size_t i {}; i < operand_count; ++i)
+        {
+            lhs.emplace_back(random_signed_width(sizes.a_bits));
+            rhs.emplace_back(random_signed_width(sizes.b_bits));
+        }
+
+        std::printf("int128_t a * b / 10^18 with random signs, %s\n", sizes.description);
+
+        // Products that may not fit would go to a bignum fallback, which this tree does not have
+        measure_binary("bit_width check, then a * b / c", lhs, rhs, [&](const int128_t a, const int128_t b)
+        {
+            const auto bits {boost::int128::bit_width(static_cast<uint128_t>(boost::int128::abs(a))) +
+                             boost::int128::bit_width(static_cast<uint128_t>(boost::int128::abs(b)))};
+
+            return bits <= 126 ? a * b / scale : int128_t{0};
+        });
+        measure_binary("muldiv truncate", lhs, rhs, [&](const int128_t a, const int128_t b) { return boost::int128::muldiv(a, b, scale); });
+        measure_binary("muldiv_floor", lhs, rhs, [&](const int128_t a, const int128_t b) { return boost::int128::muldiv_floor(a, b, scale); });
+        measure_binary("muldiv half_even", lhs, rhs, [&](const int128_t a, const int128_t b) { return boost::int128::muldiv(a, b, scale, rounding_mode::half_even); });
+        measure_binary("muldiv half_up", lhs, rhs, [&](const int128_t a, const int128_t b) { return boost::int128::muldiv(a, b, scale, rounding_mode::half_up); });
+    }
+}
+
+// gcd and gcdext for balanced and unbalanced operands, against Euclid's algorithm with operator%
+void benchmark_gcd()
+{
+    constexpr std::size_t count {1U << 12};
+
+    for (const auto b_bits : {128, 96, 64, 32})
+    {
+        std::vector<uint128_t> lhs;
+        std::vector<uint128_t> rhs;
+        for (std::size_t i {}; i < count; ++i)
+        {
+            lhs.emplace_back(random_width(128));
+            rhs.emplace_back(random_width(b_bits));
+        }
+
+        std::printf("gcd of 128 and %d-bit operands\n", b_bits);
+
+        measure_binary("Euclid with operator%", lhs, rhs, [](uint128_t a, uint128_t b)
+        {
+            while (b != 0U)
+            {
+                const auto r {a % b};
+                a = b;
+                b = r;
+            }
+            return a;
+        });
+        measure_binary("gcd", lhs, rhs, [](const uint128_t a, const uint128_t b) { return boost::int128::gcd(a, b); });
+        measure_binary("gcdext", lhs, rhs, [](const uint128_t a, const uint128_t b)
+        {
+            const auto res {boost::int128::gcdext(a, b)};
+            return res.g + static_cast<uint128_t>(res.x);
+        });
+    }
+}
+
+// lcm against dividing by the gcd with operator/, and checked_lcm, for operands whose lcm fits.
+// Nothing here needs the builtin 128-bit type, so this also runs in 32-bit builds
+void benchmark_lcm()
+{
+    constexpr std::size_t count {1U << 12};
+
+    for (const auto bits : {32, 64})
+    {
+        std::vector<uint128_t> lhs;
+        std::vector<uint128_t> rhs;
+        for (std::size_t i {}; i < count; ++i)
+        {
+            lhs.emplace_back(random_width(bits));
+            rhs.emplace_back(random_width(bits));
+        }
+
+        std::printf("lcm of %d-bit operands\n", bits);
+
+        measure_binary("a / gcd(a, b) * b", lhs, rhs, [](const uint128_t a, const uint128_t b) { return a / boost::int128::gcd(a, b) * b; });
+        measure_binary("lcm", lhs, rhs, [](const uint128_t a, const uint128_t b) { return boost::int128::lcm(a, b); });
+        measure_binary("checked_lcm", lhs, rhs, [](const uint128_t a, const uint128_t b)
+        {
+            uint128_t result {};
+            const auto overflow {boost::int128::checked_lcm(&result, a, b)};
+            return result + static_cast<std::uint64_t>(overflow);
+        });
+    }
+}
+
+// Integer roots of 64 and 128-bit values. The long double square root is the inexact approach isqrt replaces
+void benchmark_roots()
+{
+    for (const auto bits : {64, 128})
+    {
+        std::vector<uint128_t> values;
+        for (std::size_t i {}; i < operand_count; ++i)
+        {
+            values.emplace_back(random_width(bits));
+        }
+
+        std::printf("integer roots of %d-bit values\n", bits);
+
+        measure_unary("std::sqrt(long double), not exact", values, [](const uint128_t x) { return static_cast<std::uint64_t>(std::sqrt(static_cast<long double>(x))); });
+        measure_unary("isqrt", values, [](const uint128_t x) { return boost::int128::isqrt(x); });
+        measure_unary("icbrt", values, [](const uint128_t x) { return boost::int128::icbrt(x); });
+        measure_unary("iroot, n = 5", values, [](const uint128_t x) { return boost::int128::iroot(x, 5U); });
+    }
+}
+
+// Logarithms and powers against the loops they replace
+void benchmark_logs_and_powers()
+{
+    std::vector<uint128_t> values;
+    std::vector<uint128_t> bases;
+    std::vector<unsigned> exponents;
+    for (std::size_t i {}; i < operand_count; ++i)
+    {
+        values.emplace_back(random_width(1 + static_cast<int>(rng() % 128U)));
+        bases.emplace_back(2U + rng() % 998U);
+        exponents.emplace_back(static_cast<unsigned>(rng() % 64U));
+    }
+
+    std::printf("logarithms of 1 to 128-bit values\n");
+
+    measure_unary("ilog10", values, [](const uint128_t x) { return static_cast<std::uint64_t>(boost::int128::ilog10(x)); });
+    measure_unary("repeated division by 10", values, [](uint128_t x)
+    {
+        std::uint64_t log {};
+        while (x >= 10U)
+        {
+            x /= 10U;
+            ++log;
+        }
+        return log;
+    });
+    measure_unary("ilog(x, 3)", values, [](const uint128_t x) { return static_cast<std::uint64_t>(boost::int128::ilog(x, 3U)); });
+    measure_unary("repeated division by 3", values, [](uint128_t x)
+    {
+        std::uint64_t log {};
+        while (x >= 3U)
+        {
+            x /= 3U;
+            ++log;
+        }
+        return log;
+    });
+
+    std::printf("powers of bases below 1000, exponents below 64\n");
+
+    measure_binary("ipow", bases, exponents, [](const uint128_t b, const unsigned e) { return boost::int128::ipow(b, e); });
+    measure_binary("repeated multiplication", bases, exponents, [](const uint128_t b, const unsigned e)
+    {
+        uint128_t power {1U};
+        for (unsigned i {}; i < e; ++i)
+        {
+            power *= b;
+        }
+        return power;
+    });
+    measure_binary("checked_ipow", bases, exponents, [](const uint128_t b, const unsigned e)
+    {
+        uint128_t power {};
+        return boost::int128::checked_ipow(&power, b, e) ? uint128_t {} : power;
+    });
+    measure_binary("multiplication checked by division", bases, exponents, [](const uint128_t b, const unsigned e)
+    {
+        uint128_t power {1U};
+        for (unsigned i {}; i < e; ++i)
+        {
+            if (power > (std::numeric_limits<uint128_t>::max)() / b)
+            {
+                return uint128_t {};
+            }
+            power *= b;
+        }
+        return power;
+    });
+    measure_binary("pow_sat", bases, exponents, [](const uint128_t b, const unsigned e) { return boost::int128::pow_sat(b, e); });
+}
+
+// The high half and the full product next to the wrapping operator*
+void benchmark_wide_multiplication()
+{
+    std::vector<uint128_t> lhs;
+    std::vector<uint128_t> rhs;
+    std::vector<int128_t> signed_lhs;
+    std::vector<int128_t> signed_rhs;
+    for (std::size_t i {}; i < operand_count; ++i)
+    {
+        lhs.emplace_back(random_width(128));
+        rhs.emplace_back(random_width(128));
+        signed_lhs.emplace_back(random_signed_width(128));
+        signed_rhs.emplace_back(random_signed_width(128));
+    }
+
+    std::printf("wide multiplication of 128-bit operands\n");
+
+    measure_binary("operator*", lhs, rhs, [](const uint128_t x, const uint128_t y) { return x * y; });
+    measure_binary("mulhi", lhs, rhs, [](const uint128_t x, const uint128_t y) { return boost::int128::mulhi(x, y); });
+    measure_binary("mul_wide", lhs, rhs, [](const uint128_t x, const uint128_t y)
+    {
+        const auto product {boost::int128::mul_wide(x, y)};
+        return product.high ^ product.low;
+    });
+    measure_binary("mulhi, int128_t", signed_lhs, signed_rhs, [](const int128_t x, const int128_t y) { return boost::int128::mulhi(x, y); });
+}
+
+// operator* by operand width. Build with BOOST_INT128_NO_BUILTIN_INT128 to measure knuth_multiply
+void benchmark_multiplication()
+{
+    for (const auto& size : {size_class {128, 128}, size_class {128, 64}, size_class {128, 32}, size_class {64, 64}})
+    {
+        std::vector<uint128_t> lhs;
+        std::vector<uint128_t> rhs;
+        for (std::size_t i {}; i < operand_count; ++i)
+        {
+            lhs.emplace_back(random_width(size.dividend_bits));
+            rhs.emplace_back(random_width(size.divisor_bits));
+        }
+
+        std::printf("multiplication of %d and %d-bit operands\n", size.dividend_bits, size.divisor_bits);
+
+        measure_binary("operator*", lhs, rhs, [](const uint128_t x, const uint128_t y) { return x * y; });
+
+        #ifdef __SIZEOF_INT128__
+
+        const auto builtin_lhs {to_builtin(lhs)};
+        const auto builtin_rhs {to_builtin(rhs)};
+        measure_binary("unsigned __int128 *", builtin_lhs, builtin_rhs, [](const builtin_u128 x, const builtin_u128 y) { return x * y; });
+
+        #endif
+    }
+}
+
+// Checked and saturating arithmetic next to the compiler's overflow builtins
+void benchmark_checked_arithmetic()
+{
+    std::vector<uint128_t> lhs;
+    std::vector<uint128_t> rhs;
+    std::vector<int128_t> signed_lhs;
+    std::vector<int128_t> signed_rhs;
+    for (std::size_t i {}; i < operand_count; ++i)
+    {
+        lhs.emplace_back(random_width(1 + static_cast<int>(rng() % 128U)));
+        rhs.emplace_back(random_width(1 + static_cast<int>(rng() % 128U)));
+        signed_lhs.emplace_back(random_signed_width(1 + static_cast<int>(rng() % 128U)));
+        signed_rhs.emplace_back(random_signed_width(1 + static_cast<int>(rng() % 128U)));
+    }
+
+    std::printf("checked arithmetic of 1 to 128-bit operands\n");
+
+    measure_binary("ckd_add", lhs, rhs, [](const uint128_t x, const uint128_t y)
+    {
+        uint128_t result {};
+        return boost::int128::ckd_add(&result, x, y) ? uint128_t {} : result;
+    });
+    measure_binary("ckd_mul", lhs, rhs, [](const uint128_t x, const uint128_t y)
+    {
+        uint128_t result {};
+        return boost::int128::ckd_mul(&result, x, y) ? uint128_t {} : result;
+    });
+    measure_binary("ckd_add, int128_t", signed_lhs, signed_rhs, [](const int128_t x, const int128_t y)
+    {
+        int128_t result {};
+        return boost::int128::ckd_add(&result, x, y) ? int128_t {} : result;
+    });
+    measure_binary("ckd_sub, int128_t", signed_lhs, signed_rhs, [](const int128_t x, const int128_t y)
+    {
+        int128_t result {};
+        return boost::int128::ckd_sub(&result, x, y) ? int128_t {} : result;
+    });
+    measure_binary("ckd_mul, int128_t", signed_lhs, signed_rhs, [](const int128_t x, const int128_t y)
+    {
+        int128_t result {};
+        return boost::int128::ckd_mul(&result, x, y) ? int128_t {} : result;
+    });
+
+    #if defined(__SIZEOF_INT128__) && defined(__GNUC__)
+
+    const auto builtin_lhs {to_builtin(lhs)};
+    const auto builtin_rhs {to_builtin(rhs)};
+    const auto builtin_signed_lhs {to_builtin(signed_lhs)};
+    const auto builtin_signed_rhs {to_builtin(signed_rhs)};
+
+    measure_binary("__builtin_mul_overflow, unsigned", builtin_lhs, builtin_rhs, [](const builtin_u128 x, const builtin_u128 y)
+    {
+        builtin_u128 result {};
+        return __builtin_mul_overflow(x, y, &result) ? builtin_u128 {} : result;
+    });
+    measure_binary("__builtin_add_overflow, signed", builtin_signed_lhs, builtin_signed_rhs, [](const builtin_i128 x, const builtin_i128 y)
+    {
+        builtin_i128 result {};
+        return __builtin_add_overflow(x, y, &result) ? builtin_i128 {} : result;
+    });
+    measure_binary("__builtin_mul_overflow, signed", builtin_signed_lhs, builtin_signed_rhs, [](const builtin_i128 x, const builtin_i128 y)
+    {
+        builtin_i128 result {};
+        return __builtin_mul_overflow(x, y, &result) ? builtin_i128 {} : result;
+    });
+
+    #endif
+
+    std::printf("saturating arithmetic of 1 to 128-bit operands\n");
+
+    measure_binary("mul_sat", lhs, rhs, [](const uint128_t x, const uint128_t y) { return boost::int128::mul_sat(x, y); });
+    measure_binary("add_sat, int128_t", signed_lhs, signed_rhs, [](const int128_t x, const int128_t y) { return boost::int128::add_sat(x, y); });
+    measure_binary("sub_sat, int128_t", signed_lhs, signed_rhs, [](const int128_t x, const int128_t y) { return boost::int128::sub_sat(x, y); });
+    measure_binary("mul_sat, int128_t", signed_lhs, signed_rhs, [](const int128_t x, const int128_t y) { return boost::int128::mul_sat(x, y); });
+}
+
+// muladd against operator* and operator+, which drop the high half, and dot against a sum of wrapped products
+void benchmark_muladd()
+{
+    std::vector<uint128_t> lhs;
+    std::vector<uint128_t> rhs;
+    std::vector<int128_t> signed_lhs;
+    std::vector<int128_t> signed_rhs;
+    for (std::size_t i {}; i < operand_count; ++i)
+    {
+        lhs.emplace_back(random_width(128));
+        rhs.emplace_back(random_width(128));
+        signed_lhs.emplace_back(random_signed_width(128));
+        signed_rhs.emplace_back(random_signed_width(128));
+    }
+
+    std::printf("multiply and add of 128-bit operands\n");
+
+    measure_binary("x * y + y, wrapping", lhs, rhs, [](const uint128_t x, const uint128_t y) { return x * y + y; });
+    measure_binary("muladd(x, y, y)", lhs, rhs, [](const uint128_t x, const uint128_t y)
+    {
+        const auto result {boost::int128::muladd(x, y, y)};
+        return result.high ^ result.low;
+    });
+    measure_binary("muladd(x, y, y), int128_t", signed_lhs, signed_rhs, [](const int128_t x, const int128_t y)
+    {
+        const auto result {boost::int128::muladd(x, y, y)};
+        return static_cast<uint128_t>(result.high) ^ result.low;
+    });
+
+    #ifdef BOOST_INT128_HAS_SPAN
+
+    std::printf("dot products of 128-bit arrays, per element\n");
+
+    measure("sum of wrapped x * y", lhs.size(), [&]()
+    {
+        uint128_t sum {};
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            sum += lhs[i] * rhs[i];
+        }
+        return low_word(sum);
+    });
+    measure("dot", lhs.size(), [&]()
+    {
+        const auto result {boost::int128::dot(lhs, rhs)};
+        return low_word(result.high ^ result.low);
+    });
+    measure("dot, int128_t", signed_lhs.size(), [&]()
+    {
+        const auto result {boost::int128::dot(signed_lhs, signed_rhs)};
+        return low_word(static_cast<uint128_t>(result.high) ^ result.low);
+    });
+
+    #endif // BOOST_INT128_HAS_SPAN
+}
+
+// square and square_wide share the cross product that x * x and mul_wide(x, x) form twice
+void benchmark_square()
+{
+    std::vector<uint128_t> values;
+    for (std::size_t i {}; i < operand_count; ++i)
+    {
+        values.emplace_back(random_width(128));
+    }
+
+    std::printf("squares of 128-bit values\n");
+
+    measure_unary("x * x", values, [](const uint128_t x) { return x * x; });
+    measure_unary("square", values, [](const uint128_t x) { return boost::int128::square(x); });
+    measure_unary("mul_wide(x, x)", values, [](const uint128_t x)
+    {
+        const auto result {boost::int128::mul_wide(x, x)};
+        return result.high ^ result.low;
+    });
+    measure_unary("square_wide", values, [](const uint128_t x)
+    {
+        const auto result {boost::int128::square_wide(x)};
+        return result.high ^ result.low;
+    });
+}
+
+} // namespace
+
+int main()
+{
+    print_backend();
+
+    benchmark_division();
+    benchmark_divider();
+    benchmark_barrett();
+    benchmark_modular();
+    benchmark_is_prime();
+    benchmark_factorize();
+    benchmark_exact_division();
+
+    #ifdef BOOST_INT128_HAS_SPAN
+    benchmark_span_division();
+    #endif
+
+    benchmark_rounding_division();
+    benchmark_muldiv();
+    benchmark_gcd();
+    benchmark_lcm();
+    benchmark_roots();
+    benchmark_logs_and_powers();
+    benchmark_wide_multiplication();
+    benchmark_multiplication();
+    benchmark_checked_arithmetic();
+    benchmark_muladd();
+    benchmark_square();
+
+    std::printf("checksum %llu\n", static_cast<unsigned long long>(sink));
+
+    return 0;
+}
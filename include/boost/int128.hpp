@@ -6,6 +6,7 @@
 #define BOOST_INT128_HPP
 
 #include <boost/int128/int128.hpp>
+#include <boost/int128/int256.hpp>
 #include <boost/int128/bit.hpp>
 #include <boost/int128/iostream.hpp>
 #include <boost/int128/literals.hpp>
@@ -15,5 +16,9 @@
 #include <boost/int128/climits.hpp>
 #include <boost/int128/cstdlib.hpp>
 #include <boost/int128/string.hpp>
+#include <boost/int128/divider.hpp>
+#include <boost/int128/montgomery.hpp>
+#include <boost/int128/barrett.hpp>
+#include <boost/int128/primes.hpp>
 
 #endif // BOOST_INT128_HPP
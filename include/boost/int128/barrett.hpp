@@ -0,0 +1,139 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_BARRETT_HPP
+#define BOOST_INT128_BARRETT_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/bit.hpp>
+#include <boost/int128/detail/config.hpp>
+#include <boost/int128/detail/common_mul.hpp>
+#include <boost/int128/detail/common_div.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstdint>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+// Reduces many values by the same modulus, which unlike montgomery128 may be even.
+// The modulus is normalized and floor(2^256 / m) is computed once on construction,
+// after which every reduction is two multiplications and at most two conditional corrections.
+//
+// See: Paul Barrett, Implementing the Rivest Shamir and Adleman Public Key Encryption Algorithm
+// on a Standard Digital Signal Processor, CRYPTO 1986
+BOOST_INT128_EXPORT class barrett128
+{
+private:
+
+    uint128_t modulus_ {};
+    uint128_t normalized_ {};
+    uint128_t reciprocal_ {};  // floor((2^256 - 1) / normalized_) - 2^128
+    uint128_t mask_ {};        // m - 1 for a power of two, and zero for a zero modulus
+    int shift_ {};
+    bool is_power_of_two_ {true};
+
+    BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr uint128_t reduce_normalized(uint128_t u1, uint128_t u0) const noexcept;
+
+public:
+
+    constexpr barrett128() noexcept = default;
+
+    BOOST_INT128_HOST_DEVICE explicit constexpr barrett128(uint128_t modulus) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t modulus() const noexcept { return modulus_; }
+
+    // x mod m
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t reduce(uint128_t x) const noexcept;
+
+    // (high * 2^128 + low) mod m, e.g. for the full product of two values
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t reduce_wide(uint128_t high, uint128_t low) const noexcept;
+};
+
+BOOST_INT128_HOST_DEVICE constexpr barrett128::barrett128(const uint128_t modulus) noexcept : modulus_ {modulus}
+{
+    // Powers of two, including zero where every result is zero, are reduced with a mask instead
+    if (has_single_bit(modulus))
+    {
+        mask_ = modulus - 1U;
+    }
+    else if (modulus != 0U)
+    {
+        is_power_of_two_ = false;
+        shift_ = countl_zero(modulus);
+        normalized_ = modulus << shift_;
+
+        // (2^256 - 1) - 2^128 * normalized_ divided by normalized_, the quotient of which fits into 128 bits
+        const std::uint64_t u[4] {UINT64_MAX, UINT64_MAX, ~normalized_.low, ~normalized_.high};
+        std::uint64_t q[4] {};
+        std::uint64_t r_high {};
+        std::uint64_t r_low {};
+        detail::div_wide_words(u, normalized_.high, normalized_.low, q, r_high, r_low);
+
+        reciprocal_ = uint128_t{q[1], q[0]};
+    }
+}
+
+// See: Niels Moller and Torbjorn Granlund, Improved division by invariant integers, IEEE Transactions on Computers, 2011
+// Algorithm 4 with 128-bit words: the remainder of (u1, u0) by the normalized modulus, which requires u1 < normalized_
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr uint128_t barrett128::reduce_normalized(const uint128_t u1, const uint128_t u0) const noexcept
+{
+    std::uint64_t product[4] {};
+    detail::umul128_words(reciprocal_.high, reciprocal_.low, u1.high, u1.low, product);
+
+    // (q1, q0) = reciprocal_ * u1 + (u1, u0)
+    const uint128_t product_low {product[1], product[0]};
+    const auto q0 {product_low + u0};
+    auto q1 {uint128_t{product[3], product[2]} + u1};
+    q1 += static_cast<std::uint64_t>(q0 < u0) + 1U;
+
+    auto r {u0 - q1 * normalized_};
+
+    // The first adjustment is taken roughly half of the time, so it is done without branching
+    const auto mask {UINT64_C(0) - static_cast<std::uint64_t>(r > q0)};
+    r += normalized_ & uint128_t{mask, mask};
+
+    if (BOOST_INT128_UNLIKELY(r >= normalized_))
+    {
+        r -= normalized_; // LCOV_EXCL_LINE
+    }
+
+    return r >> shift_;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t barrett128::reduce(const uint128_t x) const noexcept
+{
+    if (is_power_of_two_)
+    {
+        return x & mask_;
+    }
+
+    // Shifting by 128 - shift_ would be UB for shift_ == 0
+    const auto u1 {(x >> 1U) >> (127 - shift_)};
+    return reduce_normalized(u1, x << shift_);
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t barrett128::reduce_wide(const uint128_t high, const uint128_t low) const noexcept
+{
+    if (is_power_of_two_)
+    {
+        return low & mask_;
+    }
+
+    // high * 2^128 + low == (high mod m) * 2^128 + low, and after reducing the top half
+    // the normalized value fits into 256 bits with its top half below the normalized modulus
+    const auto h {reduce(high)};
+    const auto u1 {(h << shift_) | ((low >> 1U) >> (127 - shift_))};
+    const auto u0 {low << shift_};
+
+    return reduce_normalized(u1, u0);
+}
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_BARRETT_HPP
@@ -6,6 +6,7 @@
 #define BOOST_INT128_BIT_HPP
 
 #include <boost/int128/int128.hpp>
+#include <boost/int128/int256.hpp>
 #include <boost/int128/detail/config.hpp>
 #include <boost/int128/detail/clz.hpp>
 #include <boost/int128/detail/ctz.hpp>
@@ -196,6 +197,72 @@ BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint128_t byteswap(const
 
 #endif
 
+//=====================================
+// 256-bit overloads
+//=====================================
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool has_single_bit(const uint256_t x) noexcept
+{
+    return x.high == 0U ? has_single_bit(x.low) : x.low == 0U && has_single_bit(x.high);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int countl_zero(const uint256_t x) noexcept
+{
+    return x.high == 0U ? 128 + countl_zero(x.low) : countl_zero(x.high);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int countl_one(const uint256_t x) noexcept
+{
+    return countl_zero(~x);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int bit_width(const uint256_t x) noexcept
+{
+    return x ? 256 - countl_zero(x) : 0;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t bit_ceil(const uint256_t x) noexcept
+{
+    return x <= 1U ? static_cast<uint256_t>(1U) : static_cast<uint256_t>(1U) << bit_width(x - 1U);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t bit_floor(const uint256_t x) noexcept
+{
+    return x > 0U ? static_cast<uint256_t>(1U) << (bit_width(x) - 1) : static_cast<uint256_t>(0U);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int countr_zero(const uint256_t x) noexcept
+{
+    return x.low == 0U ? 128 + countr_zero(x.high) : countr_zero(x.low);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int countr_one(const uint256_t x) noexcept
+{
+    return countr_zero(~x);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t rotl(const uint256_t x, const int s) noexcept
+{
+    constexpr auto mask {255U};
+    return x << (static_cast<unsigned>(s) & mask) | x >> (static_cast<unsigned>(-s) & mask);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t rotr(const uint256_t x, const int s) noexcept
+{
+    constexpr auto mask {255U};
+    return x >> (static_cast<unsigned>(s) & mask) | x << (static_cast<unsigned>(-s) & mask);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int popcount(const uint256_t x) noexcept
+{
+    return popcount(x.high) + popcount(x.low);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t byteswap(const uint256_t x) noexcept
+{
+    return {byteswap(x.low), byteswap(x.high)};
+}
+
 } // namespace int128
 } // namespace boost
 
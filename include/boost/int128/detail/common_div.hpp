@@ -7,11 +7,11 @@
 
 #include <boost/int128/detail/config.hpp>
 #include <boost/int128/detail/clz.hpp>
+#include <boost/int128/detail/common_mul.hpp>
 
 #ifndef BOOST_INT128_BUILD_MODULE
 
 #include <cstdint>
-#include <cstring>
 
 #endif
 
@@ -67,204 +67,373 @@ BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr void half_word_div(
 
 namespace impl {
 
-#if defined(_MSC_VER)
-#  pragma warning(push)
-#  pragma warning(disable : 4127) // Pre c++17 the if constexpr remainder part will hit this
+#if !(defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA))
+
+// Initial 11-bit approximations of the reciprocal, indexed by the 9 most significant bits of the divisor
+// reciprocal_table[i] = floor((2^19 - 3 * 2^8) / (256 + i))
+BOOST_INT128_INLINE_CONSTEXPR std::uint16_t reciprocal_table[256] = {
+    0x7fd, 0x7f5, 0x7ed, 0x7e5, 0x7dd, 0x7d5, 0x7ce, 0x7c6,
+    0x7bf, 0x7b7, 0x7b0, 0x7a8, 0x7a1, 0x79a, 0x792, 0x78b,
+    0x784, 0x77d, 0x776, 0x76f, 0x768, 0x761, 0x75b, 0x754,
+    0x74d, 0x747, 0x740, 0x739, 0x733, 0x72c, 0x726, 0x720,
+    0x719, 0x713, 0x70d, 0x707, 0x700, 0x6fa, 0x6f4, 0x6ee,
+    0x6e8, 0x6e2, 0x6dc, 0x6d6, 0x6d1, 0x6cb, 0x6c5, 0x6bf,
+    0x6ba, 0x6b4, 0x6ae, 0x6a9, 0x6a3, 0x69e, 0x698, 0x693,
+    0x68d, 0x688, 0x683, 0x67d, 0x678, 0x673, 0x66e, 0x669,
+    0x664, 0x65e, 0x659, 0x654, 0x64f, 0x64a, 0x645, 0x640,
+    0x63c, 0x637, 0x632, 0x62d, 0x628, 0x624, 0x61f, 0x61a,
+    0x616, 0x611, 0x60c, 0x608, 0x603, 0x5ff, 0x5fa, 0x5f6,
+    0x5f1, 0x5ed, 0x5e9, 0x5e4, 0x5e0, 0x5dc, 0x5d7, 0x5d3,
+    0x5cf, 0x5cb, 0x5c6, 0x5c2, 0x5be, 0x5ba, 0x5b6, 0x5b2,
+    0x5ae, 0x5aa, 0x5a6, 0x5a2, 0x59e, 0x59a, 0x596, 0x592,
+    0x58e, 0x58a, 0x586, 0x583, 0x57f, 0x57b, 0x577, 0x574,
+    0x570, 0x56c, 0x568, 0x565, 0x561, 0x55e, 0x55a, 0x556,
+    0x553, 0x54f, 0x54c, 0x548, 0x545, 0x541, 0x53e, 0x53a,
+    0x537, 0x534, 0x530, 0x52d, 0x52a, 0x526, 0x523, 0x520,
+    0x51c, 0x519, 0x516, 0x513, 0x50f, 0x50c, 0x509, 0x506,
+    0x503, 0x500, 0x4fc, 0x4f9, 0x4f6, 0x4f3, 0x4f0, 0x4ed,
+    0x4ea, 0x4e7, 0x4e4, 0x4e1, 0x4de, 0x4db, 0x4d8, 0x4d5,
+    0x4d2, 0x4cf, 0x4cc, 0x4ca, 0x4c7, 0x4c4, 0x4c1, 0x4be,
+    0x4bb, 0x4b9, 0x4b6, 0x4b3, 0x4b0, 0x4ad, 0x4ab, 0x4a8,
+    0x4a5, 0x4a3, 0x4a0, 0x49d, 0x49b, 0x498, 0x495, 0x493,
+    0x490, 0x48d, 0x48b, 0x488, 0x486, 0x483, 0x481, 0x47e,
+    0x47c, 0x479, 0x477, 0x474, 0x472, 0x46f, 0x46d, 0x46a,
+    0x468, 0x465, 0x463, 0x461, 0x45e, 0x45c, 0x459, 0x457,
+    0x455, 0x452, 0x450, 0x44e, 0x44b, 0x449, 0x447, 0x444,
+    0x442, 0x440, 0x43e, 0x43b, 0x439, 0x437, 0x435, 0x432,
+    0x430, 0x42e, 0x42c, 0x42a, 0x428, 0x425, 0x423, 0x421,
+    0x41f, 0x41d, 0x41b, 0x419, 0x417, 0x414, 0x412, 0x410,
+    0x40e, 0x40c, 0x40a, 0x408, 0x406, 0x404, 0x402, 0x400
+};
+
 #endif
 
-template <std::size_t v_size>
-BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr void unpack_v(std::uint32_t (&vn)[4], const std::uint32_t (&v)[v_size],
-    const bool needs_shift, const int s, const int complement_s, const std::integral_constant<std::size_t, 2>&) noexcept
+} // namespace impl
+
+// See: Niels Moller and Torbjorn Granlund, Improved division by invariant integers, IEEE Transactions on Computers, 2011
+// Algorithm 3: Computes v = floor((2^128 - 1) / d) - 2^64 for a normalized d (most significant bit set)
+// using only multiplications, so it is also cheap on targets without a hardware divide
+BOOST_INT128_HOST_DEVICE constexpr std::uint64_t reciprocal_2by1(const std::uint64_t d) noexcept
 {
-    vn[1] = needs_shift ? ((v[1] << s) | (v[0] >> complement_s)) : v[1];
-    vn[0] = needs_shift ? (v[0] << s) : v[0];
+    BOOST_INT128_ASSUME((d >> 63U) == 1U); // LCOV_EXCL_LINE
+
+    const auto d0 {d & 1U};
+    const auto d9 {d >> 55U};
+    const auto d40 {(d >> 24U) + 1U};
+    const auto d63 {(d >> 1U) + d0};
+
+    #if defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA)
+    const auto v0 {static_cast<std::uint64_t>(UINT32_C(0x7fd00) / static_cast<std::uint32_t>(d9))};
+    #else
+    const auto v0 {static_cast<std::uint64_t>(impl::reciprocal_table[d9 - 256U])};
+    #endif
+
+    const auto v1 {(v0 << 11U) - ((v0 * v0 * d40) >> 40U) - 1U};
+    const auto v2 {(v1 << 13U) + ((v1 * ((UINT64_C(1) << 60U) - v1 * d40)) >> 47U)};
+
+    const auto e {((v2 >> 1U) & (UINT64_C(0) - d0)) - v2 * d63};
+    std::uint64_t v2e_high {};
+    umul64(v2, e, v2e_high);
+    const auto v3 {(v2e_high >> 1U) + (v2 << 31U)};
+
+    std::uint64_t v3d_high {};
+    auto v3d_low {umul64(v3, d, v3d_high)};
+    v3d_low += d;
+    v3d_high += static_cast<std::uint64_t>(v3d_low < d);
+
+    return v3 - v3d_high - d;
 }
 
-template <std::size_t v_size>
-BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr void unpack_v(std::uint32_t (&vn)[4], const std::uint32_t (&v)[v_size],
-    const bool needs_shift, const int s, const int complement_s, const std::integral_constant<std::size_t, 4>&) noexcept
+// Algorithm 4: Divides the two word number (u1, u0) by the normalized d with reciprocal v = reciprocal_2by1(d)
+// Requires u1 < d so that the quotient fits into a single word
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr std::uint64_t div_2by1(const std::uint64_t u1, const std::uint64_t u0,
+                                                                                   const std::uint64_t d, const std::uint64_t v,
+                                                                                   std::uint64_t& remainder) noexcept
 {
-    vn[3] = needs_shift ? ((v[3] << s) | (v[2] >> complement_s)) : v[3];
-    vn[2] = needs_shift ? ((v[2] << s) | (v[1] >> complement_s)) : v[2];
-    vn[1] = needs_shift ? ((v[1] << s) | (v[0] >> complement_s)) : v[1];
-    vn[0] = needs_shift ? (v[0] << s) : v[0];
+    BOOST_INT128_ASSUME(u1 < d); // LCOV_EXCL_LINE
+
+    std::uint64_t q1 {};
+    auto q0 {umul64(v, u1, q1)};
+
+    q0 += u0;
+    q1 += u1 + static_cast<std::uint64_t>(q0 < u0) + 1U;
+
+    auto r {u0 - q1 * d};
+
+    // The first adjustment is taken roughly half of the time, so it is done without branching
+    const auto mask {UINT64_C(0) - static_cast<std::uint64_t>(r > q0)};
+    q1 += mask;
+    r += mask & d;
+
+    if (BOOST_INT128_UNLIKELY(r >= d))
+    {
+        ++q1;       // LCOV_EXCL_LINE
+        r -= d;     // LCOV_EXCL_LINE
+    }
+
+    remainder = r;
+    return q1;
 }
 
-// See: The Art of Computer Programming Volume 2 (Semi-numerical algorithms) section 4.3.1
-// Algorithm D: Division of Non-negative integers
-template <bool need_remainder, std::size_t u_size, std::size_t v_size, std::size_t q_size>
-BOOST_INT128_HOST_DEVICE constexpr void knuth_divide(std::uint32_t (&u)[u_size], const std::size_t m,
-                            const std::uint32_t (&v)[v_size], const std::size_t n,
-                            std::uint32_t (&q)[q_size]) noexcept
+// Divides (u_high, u_low) by a one word divisor that has been normalized by shift into d, with v = reciprocal_2by1(d)
+// The quotient is written into (q_high, q_low) and the remainder is returned
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr std::uint64_t one_word_div_preinv(const std::uint64_t u_high, const std::uint64_t u_low,
+                                                                                              const std::uint64_t d, const std::uint64_t v, const int shift,
+                                                                                              std::uint64_t& q_high, std::uint64_t& q_low) noexcept
 {
-    // D.1
-    const auto s {countl_zero(v[n - 1])};
-    const auto complement_s {32 - s};
-    const bool needs_shift {s > 0};
-
-    // Create normalized versions of u and v
-    std::uint32_t un[5] {};
-    std::uint32_t vn[4] {};
-
-    un[4] = needs_shift ? (u[3] >> complement_s) : 0;
-    un[3] = needs_shift ? ((u[3] << s) | (u[2] >> complement_s)) : u[3];
-    un[2] = needs_shift ? ((u[2] << s) | (u[1] >> complement_s)) : u[2];
-    un[1] = needs_shift ? ((u[1] << s) | (u[0] >> complement_s)) : u[1];
-    un[0] = needs_shift ? (u[0] << s) : u[0];
-
-    static_assert(v_size == 4 || v_size == 2, "Unknown size for denominator");
-    unpack_v(vn, v, needs_shift, s, complement_s, std::integral_constant<std::size_t, v_size>{});
-
-    // D.2
-    for (std::size_t j {m - n}; j != static_cast<std::size_t>(-1); --j)
-    {
-        // D.3
-        const auto dividend {(static_cast<std::uint64_t>(un[j+n]) << 32) | un[j+n-1]};
-        const auto divisor {static_cast<std::uint64_t>(vn[n-1])};
-        auto q_hat {dividend / divisor};
-        auto r_hat {dividend % divisor};
-
-        while (q_hat > UINT32_MAX ||
-               (q_hat * vn[n-2]) > ((r_hat << 32) | un[j+n-2]))
-        {
-            q_hat--;
-            r_hat += vn[n-1];
-            if (r_hat > UINT32_MAX)
-            {
-                break;
-            }
-        }
+    // Shift the dividend by the same amount as the divisor into three words: n2, n1, n0
+    // The double shift avoids shifting by 64 when the divisor is already normalized
+    const auto n2 {(u_high >> 1U) >> (63 - shift)};
+    const auto n1 {(u_high << shift) | ((u_low >> 1U) >> (63 - shift))};
+    const auto n0 {u_low << shift};
 
-        // D.4
-        std::int64_t borrow {};
-        for (std::size_t i {}; i < n; ++i)
-        {
-            const auto p {q_hat * vn[i]};
-            const auto p_lo {static_cast<std::uint32_t>(p & UINT32_MAX)};
-            const auto p_hi {static_cast<std::uint32_t>(p >> 32)};
+    std::uint64_t r {};
+    q_high = div_2by1(n2, n1, d, v, r);
+    q_low = div_2by1(r, n0, d, v, r);
 
-            borrow += static_cast<std::int64_t>(un[j+i]) - static_cast<std::int64_t>(p_lo);
-            un[j+i] = static_cast<std::uint32_t>(borrow & UINT32_MAX);
-            borrow >>= 32;
+    return r >> shift;
+}
 
-            borrow -= p_hi;
-        }
-        borrow += un[j+n];
-        un[j+n] = static_cast<std::uint32_t>(borrow & UINT32_MAX);
+// See: Henry S. Warren, Hacker's Delight 2nd Edition, section 9-5
+// Unsigned doubleword division from long division
+//
+// Given q1, the single word quotient of the halved dividend by the most significant word of the divisor
+// normalized by shift, computes the quotient of (u_high, u_low) by (divisor_high, divisor_low) where divisor_high != 0.
+// The remainder is written into (r_high, r_low) and the single word quotient is returned
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr std::uint64_t two_word_div_correct(const std::uint64_t u_high, const std::uint64_t u_low,
+                                                                                               const std::uint64_t divisor_high, const std::uint64_t divisor_low,
+                                                                                               const std::uint64_t q1, const int shift,
+                                                                                               std::uint64_t& r_high, std::uint64_t& r_low) noexcept
+{
+    // Undo the normalization and the halving, which leaves us with q or q + 1,
+    // so we step down once and then correct upwards against the true remainder
+    auto q0 {q1 >> (63 - shift)};
+    q0 -= static_cast<std::uint64_t>(q0 != 0U);
+
+    std::uint64_t product_high {};
+    const auto product_low {umul64(q0, divisor_low, product_high)};
+    product_high += q0 * divisor_high;
+
+    const auto diff_low {u_low - product_low};
+    const auto diff_high {u_high - product_high - static_cast<std::uint64_t>(u_low < product_low)};
+
+    // The final correction is taken about half of the time, so it is done without branching
+    // and the comparison is combined bitwise, since a short circuit is itself a branch that mispredicts on small dividends
+    const auto correction {static_cast<std::uint64_t>(diff_high > divisor_high) |
+                           (static_cast<std::uint64_t>(diff_high == divisor_high) & static_cast<std::uint64_t>(diff_low >= divisor_low))};
+    const auto mask {UINT64_C(0) - correction};
+    const auto sub_low {divisor_low & mask};
+    const auto sub_high {divisor_high & mask};
+
+    r_low = diff_low - sub_low;
+    r_high = diff_high - sub_high - static_cast<std::uint64_t>(diff_low < sub_low);
+
+    return q0 + correction;
+}
 
-        // D.5
-        q[j] = static_cast<std::uint32_t>(q_hat & UINT32_MAX);
-        if (BOOST_INT128_UNLIKELY(borrow < 0))
-        {
-            // D.6
-            // The probability of hitting this path is about 4.7e-10
-            --q[j];                                                             // LCOV_EXCL_LINE
-            std::uint64_t carry {};                                             // LCOV_EXCL_LINE
-            for (std::size_t i = 0; i < n; ++i)                                 // LCOV_EXCL_LINE
-            {                                                                   // LCOV_EXCL_LINE
-                carry += static_cast<std::uint64_t>(un[j+i]) + vn[i];           // LCOV_EXCL_LINE
-                un[j+i] = static_cast<std::uint32_t>(carry & UINT32_MAX);       // LCOV_EXCL_LINE
-                carry >>= 32U;                                                  // LCOV_EXCL_LINE
-            }                                                                   // LCOV_EXCL_LINE
-            un[j+n] += static_cast<std::uint32_t>(carry & UINT32_MAX);          // LCOV_EXCL_LINE
-        }
-    }
+// Same as above with q1 computed from d, the normalized most significant word of the divisor, and v = reciprocal_2by1(d)
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr std::uint64_t two_word_div_preinv(const std::uint64_t u_high, const std::uint64_t u_low,
+                                                                                              const std::uint64_t divisor_high, const std::uint64_t divisor_low,
+                                                                                              const std::uint64_t d, const std::uint64_t v, const int shift,
+                                                                                              std::uint64_t& r_high, std::uint64_t& r_low) noexcept
+{
+    // Halving the dividend guarantees the high word is less than the normalized divisor
+    const auto u1 {u_high >> 1U};
+    const auto u0 {(u_low >> 1U) | (u_high << 63U)};
+
+    std::uint64_t unused_remainder {};
+    const auto q1 {div_2by1(u1, u0, d, v, unused_remainder)};
+
+    return two_word_div_correct(u_high, u_low, divisor_high, divisor_low, q1, shift, r_high, r_low);
+}
 
-    // D.8
-    // If we are only calculating division we can completely skip this step
-    BOOST_INT128_IF_CONSTEXPR (need_remainder)
+// See: Niels Moller and Torbjorn Granlund, Improved division by invariant integers, IEEE Transactions on Computers, 2011
+// Algorithm 6: Computes v = floor((2^192 - 1) / (d1, d0)) - 2^64 for the normalized two word divisor (d1, d0)
+BOOST_INT128_HOST_DEVICE constexpr std::uint64_t reciprocal_3by2(const std::uint64_t d1, const std::uint64_t d0) noexcept
+{
+    auto v {reciprocal_2by1(d1)};
+    auto p {d1 * v};
+
+    p += d0;
+    if (p < d0)
     {
-        if (s > 0)
-        {
-            for (std::size_t i {}; i < n-1; i++)
-            {
-                u[i] = (un[i] >> s) | (un[i+1] << (32 - s));
-            }
-            u[n-1] = un[n-1] >> s;
-        }
-        else
+        --v;
+        if (p >= d1)
         {
-            for (std::size_t i {}; i < n; i++)
-            {
-                u[i] = un[i];
-            }
+            --v;
+            p -= d1;
         }
+        p -= d1;
+    }
 
-        // Clear anything left in u
-        for (std::size_t i {n}; i < m; i++)
+    std::uint64_t t1 {};
+    const auto t0 {umul64(v, d0, t1)};
+
+    p += t1;
+    if (p < t1)
+    {
+        --v;
+        if (p > d1 || (p == d1 && t0 >= d0))
         {
-            u[i] = 0;
+            --v;
         }
     }
-}
 
-#if defined(_MSC_VER)
-#  pragma warning(pop)
-#endif
+    return v;
+}
 
-template <typename T>
-BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr std::size_t to_words(const T& x, std::uint32_t (&words)[4]) noexcept
+// Algorithm 5: Divides the three word number (u2, u1, u0) by the normalized (d1, d0) with v = reciprocal_3by2(d1, d0)
+// Requires (u2, u1) < (d1, d0) so that the quotient fits into a single word, and the remainder is written into (r1, r0)
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr std::uint64_t div_3by2(const std::uint64_t u2, const std::uint64_t u1, const std::uint64_t u0,
+                                                                                   const std::uint64_t d1, const std::uint64_t d0, const std::uint64_t v,
+                                                                                   std::uint64_t& r1, std::uint64_t& r0) noexcept
 {
-    #if !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION) && !BOOST_INT128_ENDIAN_BIG_BYTE
-    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(x))
-    {
-        std::memcpy(&words, &x, sizeof(T));
-    }
-    else
-    #endif
+    std::uint64_t q1 {};
+    auto q0 {umul64(v, u2, q1)};
+
+    q0 += u1;
+    q1 += u2 + static_cast<std::uint64_t>(q0 < u1);
+
+    r1 = u1 - q1 * d1;
+
+    std::uint64_t t1 {};
+    const auto t0 {umul64(d0, q1, t1)};
+
+    // (r1, r0) = (r1, u0) - (t1, t0) - (d1, d0)
+    r0 = u0 - t0;
+    r1 = r1 - t1 - static_cast<std::uint64_t>(u0 < t0);
+    const auto borrow {static_cast<std::uint64_t>(r0 < d0)};
+    r0 -= d0;
+    r1 = r1 - d1 - borrow;
+
+    ++q1;
+
+    if (r1 >= q0)
     {
-        words[0] = static_cast<std::uint32_t>(x.low & UINT32_MAX);                              // LCOV_EXCL_LINE
-        words[1] = static_cast<std::uint32_t>(x.low >> 32);                                     // LCOV_EXCL_LINE
-        words[2] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(x.high) & UINT32_MAX); // LCOV_EXCL_LINE
-        words[3] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(x.high) >> 32);        // LCOV_EXCL_LINE
+        --q1;
+        r0 += d0;
+        r1 += d1 + static_cast<std::uint64_t>(r0 < d0);
     }
 
-    BOOST_INT128_ASSERT_MSG(x != static_cast<T>(0), "Division by 0");
-
-    std::size_t word_count {4};
-    while (words[word_count - 1U] == 0U)
+    if (BOOST_INT128_UNLIKELY(r1 > d1 || (r1 == d1 && r0 >= d0)))
     {
-        word_count--;
+        ++q1;                                                   // LCOV_EXCL_LINE
+        r1 = r1 - d1 - static_cast<std::uint64_t>(r0 < d0);     // LCOV_EXCL_LINE
+        r0 -= d0;                                               // LCOV_EXCL_LINE
     }
 
-    return word_count;
+    return q1;
 }
 
-BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr std::size_t to_words(const std::uint64_t x, std::uint32_t (&words)[2]) noexcept
+// Divides the four word number u (u[0] least significant) by the non-zero (divisor_high, divisor_low)
+// The quotient is written into q, and the remainder into (r_high, r_low)
+BOOST_INT128_HOST_DEVICE constexpr void div_wide_words(const std::uint64_t (&u)[4], const std::uint64_t divisor_high, const std::uint64_t divisor_low,
+                                                       std::uint64_t (&q)[4], std::uint64_t& r_high, std::uint64_t& r_low) noexcept
 {
-    #if !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION) && !BOOST_INT128_ENDIAN_BIG_BYTE
-    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(x))
+    BOOST_INT128_ASSUME((divisor_high | divisor_low) != 0U); // LCOV_EXCL_LINE
+
+    const auto shift {divisor_high != 0U ? countl_zero(divisor_high) : countl_zero(divisor_low)};
+
+    // Normalize the dividend into five words. Shifting by (64 - shift) would be UB for shift == 0
+    std::uint64_t un[5] {};
+    un[4] = (u[3] >> 1U) >> (63 - shift);
+    for (std::size_t i {3}; i > 0; --i)
     {
-        std::memcpy(&words, &x, sizeof(std::uint64_t));
+        un[i] = (u[i] << shift) | ((u[i - 1] >> 1U) >> (63 - shift));
     }
-    else
-    #endif
+    un[0] = u[0] << shift;
+
+    if (divisor_high == 0U)
     {
-        words[0] = static_cast<std::uint32_t>(x & UINT32_MAX);  // LCOV_EXCL_LINE
-        words[1] = static_cast<std::uint32_t>(x >> 32);         // LCOV_EXCL_LINE
+        const auto d {divisor_low << shift};
+        const auto v {reciprocal_2by1(d)};
+
+        auto r {un[4]};
+        for (std::size_t i {4}; i > 0; --i)
+        {
+            q[i - 1] = div_2by1(r, un[i - 1], d, v, r);
+        }
+
+        r_high = 0U;
+        r_low = r >> shift;
     }
+    else
+    {
+        const auto d1 {(divisor_high << shift) | ((divisor_low >> 1U) >> (63 - shift))};
+        const auto d0 {divisor_low << shift};
+        const auto v {reciprocal_3by2(d1, d0)};
+
+        auto r1 {un[4]};
+        auto r0 {un[3]};
+        q[3] = 0U;
+        for (std::size_t i {3}; i > 0; --i)
+        {
+            q[i - 1] = div_3by2(r1, r0, un[i - 1], d1, d0, v, r1, r0);
+        }
 
-    return x > UINT32_MAX ? 2 : 1;
+        r_high = r1 >> shift;
+        r_low = (r0 >> shift) | ((r1 << 1U) << (63 - shift));
+    }
 }
 
-BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr std::size_t to_words(const std::uint32_t x, std::uint32_t (&words)[1]) noexcept
-{
-    words[0] = x;
+#ifdef BOOST_INT128_HAS_INLINE_DIVQ
 
-    return 1;
+// GCC and Clang do not expose the 128/64 divide instruction, and the __udivti3/__umodti3 libcalls
+// they emit for unsigned __int128 can neither be inlined nor specialized on the size of the divisor.
+// Requires high < divisor, otherwise the quotient does not fit and the instruction faults.
+// volatile keeps the compiler from hoisting it out of the branch that checks this
+BOOST_INT128_FORCE_INLINE std::uint64_t udiv128_divq(const std::uint64_t high, const std::uint64_t low, const std::uint64_t divisor, std::uint64_t& remainder) noexcept
+{
+    std::uint64_t quotient {};
+    __asm__ volatile ("divq %[divisor]" : "=a"(quotient), "=d"(remainder) : [divisor] "r"(divisor), "a"(low), "d"(high));
+    return quotient;
 }
 
 template <typename T>
-BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr T from_words(const std::uint32_t (&words)[4]) noexcept
+BOOST_INT128_FORCE_INLINE T div_mod_divq(const T& dividend, const T& divisor, T& remainder) noexcept
 {
     using high_word_type = decltype(T{}.high);
 
-    const auto low {static_cast<std::uint64_t>(words[0]) | (static_cast<std::uint64_t>(words[1]) << 32)};
-    const auto high {static_cast<std::uint64_t>(words[2]) | (static_cast<std::uint64_t>(words[3]) << 32)};
+    const auto dividend_high {static_cast<std::uint64_t>(dividend.high)};
+    const auto divisor_high {static_cast<std::uint64_t>(divisor.high)};
+
+    if (divisor_high == 0U)
+    {
+        std::uint64_t r {};
+
+        if (dividend_high < divisor.low)
+        {
+            // 128/64 with a one word quotient is a single instruction
+            const auto q {udiv128_divq(dividend_high, dividend.low, divisor.low, r)};
+            remainder = T{0, r};
+            return T{0, q};
+        }
+
+        const auto q_high {dividend_high / divisor.low};
+        const auto q_low {udiv128_divq(dividend_high % divisor.low, dividend.low, divisor.low, r)};
+        remainder = T{0, r};
+        return T{static_cast<high_word_type>(q_high), q_low};
+    }
+
+    // 128/128: one normalized divide, the same as two_word_div_preinv but with the hardware doing the 2-by-1 step
+    const auto shift {countl_zero(divisor_high)};
+    const auto d {(divisor_high << shift) | ((divisor.low >> 1U) >> (63 - shift))};
 
-    return {static_cast<high_word_type>(high), low};
+    std::uint64_t unused_remainder {};
+    const auto q1 {udiv128_divq(dividend_high >> 1U, (dividend.low >> 1U) | (dividend_high << 63U), d, unused_remainder)};
+
+    std::uint64_t r_high {};
+    std::uint64_t r_low {};
+    const auto q {two_word_div_correct(dividend_high, dividend.low, divisor_high, divisor.low, q1, shift, r_high, r_low)};
+
+    remainder = T{static_cast<high_word_type>(r_high), r_low};
+    return T{0, q};
 }
 
+#endif // BOOST_INT128_HAS_INLINE_DIVQ
+
+namespace impl {
+
 #if defined(_M_AMD64) && !defined(__GNUC__) && !defined(__clang__) && _MSC_VER >= 1920
 
 template <bool needs_mod, typename T>
@@ -409,6 +578,18 @@ BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr void one_word_div(c
         return;
     }
 
+    #elif defined(BOOST_INT128_HAS_INLINE_DIVQ) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+    {
+        using high_word_type = decltype(T{}.high);
+
+        quotient.high = static_cast<high_word_type>(static_cast<std::uint64_t>(lhs.high) / rhs);
+        std::uint64_t remainder {};
+        quotient.low = udiv128_divq(static_cast<std::uint64_t>(lhs.high) % rhs, lhs.low, rhs, remainder);
+        return;
+    }
+
     #endif
 
     if (rhs <= UINT32_MAX)
@@ -417,16 +598,18 @@ BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr void one_word_div(c
     }
     else
     {
-        std::uint32_t u[4] {};
-        std::uint32_t v[2] {};
-        std::uint32_t q[4] {};
+        using high_word_type = decltype(T{}.high);
 
-        const auto m {impl::to_words(lhs, u)};
-        const auto n {impl::to_words(rhs, v)};
+        // Without a hardware 128/64 divide the reciprocal costs a handful of multiplications,
+        // which is far cheaper than the 64-bit divisions and normalization loops of Algorithm D
+        const auto shift {countl_zero(rhs)};
+        const auto d {rhs << shift};
 
-        impl::knuth_divide<false>(u, m, v, n, q);
+        std::uint64_t q_high {};
+        std::uint64_t q_low {};
+        one_word_div_preinv(static_cast<std::uint64_t>(lhs.high), lhs.low, d, reciprocal_2by1(d), shift, q_high, q_low);
 
-        quotient = impl::from_words<T>(q);
+        quotient = T{static_cast<high_word_type>(q_high), q_low};
     }
 }
 
@@ -447,23 +630,38 @@ BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr void one_word_div(c
 
     #else
 
+    #if defined(BOOST_INT128_HAS_INLINE_DIVQ) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+    {
+        using high_word_type = decltype(T{}.high);
+
+        quotient.high = static_cast<high_word_type>(static_cast<std::uint64_t>(lhs.high) / rhs);
+        std::uint64_t r {};
+        quotient.low = udiv128_divq(static_cast<std::uint64_t>(lhs.high) % rhs, lhs.low, rhs, r);
+        remainder = T{0, r};
+        return;
+    }
+
+    #endif
+
     if (rhs <= UINT32_MAX)
     {
         half_word_div(lhs, static_cast<std::uint32_t>(rhs), quotient, remainder);
     }
     else
     {
-        std::uint32_t u[4] {};
-        std::uint32_t v[2] {};
-        std::uint32_t q[4] {};
+        using high_word_type = decltype(T{}.high);
 
-        const auto m {impl::to_words(lhs, u)};
-        const auto n {impl::to_words(rhs, v)};
+        const auto shift {countl_zero(rhs)};
+        const auto d {rhs << shift};
 
-        impl::knuth_divide<true>(u, m, v, n, q);
+        std::uint64_t q_high {};
+        std::uint64_t q_low {};
+        const auto r {one_word_div_preinv(static_cast<std::uint64_t>(lhs.high), lhs.low, d, reciprocal_2by1(d), shift, q_high, q_low)};
 
-        quotient = impl::from_words<T>(q);
-        remainder = impl::from_words<T>(u);
+        quotient = T{static_cast<high_word_type>(q_high), q_low};
+        remainder = T{0, r};
     }
 
     #endif
@@ -481,6 +679,45 @@ BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr void one_word_div(c
     half_word_div(lhs, rhs, quotient);
 }
 
+namespace impl {
+
+// Full width division of two non-negative values using the reciprocal of the most significant divisor word
+template <typename T>
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr T reciprocal_div(const T& dividend, const T& divisor, T& remainder) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    BOOST_INT128_ASSERT_MSG(divisor != static_cast<T>(0), "Division by 0");
+
+    const auto dividend_high {static_cast<std::uint64_t>(dividend.high)};
+    const auto divisor_high {static_cast<std::uint64_t>(divisor.high)};
+
+    if (divisor_high == 0U)
+    {
+        const auto shift {countl_zero(divisor.low)};
+        const auto d {divisor.low << shift};
+
+        std::uint64_t q_high {};
+        std::uint64_t q_low {};
+        const auto r {one_word_div_preinv(dividend_high, dividend.low, d, reciprocal_2by1(d), shift, q_high, q_low)};
+
+        remainder = T{0, r};
+        return T{static_cast<high_word_type>(q_high), q_low};
+    }
+
+    const auto shift {countl_zero(divisor_high)};
+    const auto d {(divisor_high << shift) | ((divisor.low >> 1U) >> (63 - shift))};
+
+    std::uint64_t r_high {};
+    std::uint64_t r_low {};
+    const auto q {two_word_div_preinv(dividend_high, dividend.low, divisor_high, divisor.low, d, reciprocal_2by1(d), shift, r_high, r_low)};
+
+    remainder = T{static_cast<high_word_type>(r_high), r_low};
+    return T{0, q};
+}
+
+} // namespace impl
+
 #ifdef _MSC_VER
 #  pragma warning(push)
 #  pragma warning(disable : 4127) // Conditional expression is constant is true pre-C++17
@@ -503,19 +740,18 @@ BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr T knuth_div(const T
         }
     }
 
-    #endif
-
-    std::uint32_t u[4]{};
-    std::uint32_t v[4]{};
-    std::uint32_t q[4]{};
-
-    const auto m{ impl::to_words(dividend, u) };
-    const auto n{ impl::to_words(divisor, v) };
+    #elif defined(BOOST_INT128_HAS_INLINE_DIVQ) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
 
-    impl::knuth_divide<false>(u, m, v, n, q);
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(dividend))
+    {
+        T remainder {};
+        return div_mod_divq(dividend, divisor, remainder);
+    }
 
-    return impl::from_words<T>(q);
+    #endif
 
+    T remainder {};
+    return impl::reciprocal_div(dividend, divisor, remainder);
 }
 
 template <typename T>
@@ -533,26 +769,152 @@ BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr T knuth_div(const T
         }
     }
 
+    #elif defined(BOOST_INT128_HAS_INLINE_DIVQ) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(dividend))
+    {
+        return div_mod_divq(dividend, divisor, remainder);
+    }
 
     #endif
 
-    std::uint32_t u[4]{};
-    std::uint32_t v[4]{};
-    std::uint32_t q[4]{};
+    return impl::reciprocal_div(dividend, divisor, remainder);
+}
+
+#ifdef _MSC_VER
+#  pragma warning(pop)
+#endif
+
+// Division by a compile time constant
+// See: Torbjorn Granlund and Peter L. Montgomery, Division by Invariant Integers using Multiplication, 1994
+// The multiplier and shift are generated the same way as libdivide does for the smaller integer types
+struct constant_divisor_magic
+{
+    std::uint64_t magic_high;
+    std::uint64_t magic_low;
+    int shift;
+    bool is_power_of_two;
+    bool needs_add;
+};
+
+BOOST_INT128_HOST_DEVICE constexpr constant_divisor_magic make_constant_divisor_magic(const std::uint64_t divisor_high, const std::uint64_t divisor_low) noexcept
+{
+    const auto floor_log2 {divisor_high != 0U ? 127 - countl_zero(divisor_high) : 63 - countl_zero(divisor_low)};
 
-    const auto m{ impl::to_words(dividend, u) };
-    const auto n{ impl::to_words(divisor, v) };
+    const bool is_power_of_two {divisor_high != 0U ? (divisor_low == 0U && (divisor_high & (divisor_high - 1U)) == 0U) :
+                                                     (divisor_low & (divisor_low - 1U)) == 0U};
 
-    impl::knuth_divide<true>(u, m, v, n, q);
+    if (is_power_of_two)
+    {
+        return constant_divisor_magic{0U, 0U, floor_log2, true, false};
+    }
 
-    remainder = impl::from_words<T>(u);
+    // Restoring division of 2^(128 + floor_log2) by the divisor.
+    // This is only ever evaluated at compile time so the bit by bit loop costs nothing at runtime
+    std::uint64_t rem_high {floor_log2 >= 64 ? UINT64_C(1) << (floor_log2 - 64) : 0U};
+    std::uint64_t rem_low {floor_log2 >= 64 ? 0U : UINT64_C(1) << floor_log2};
+    std::uint64_t q_high {};
+    std::uint64_t q_low {};
+
+    for (int i {}; i < 128; ++i)
+    {
+        const bool carry {(rem_high >> 63U) != 0U};
+        rem_high = (rem_high << 1U) | (rem_low >> 63U);
+        rem_low <<= 1U;
+        q_high = (q_high << 1U) | (q_low >> 63U);
+        q_low <<= 1U;
+
+        if (carry || rem_high > divisor_high || (rem_high == divisor_high && rem_low >= divisor_low))
+        {
+            rem_high -= divisor_high + static_cast<std::uint64_t>(rem_low < divisor_low);
+            rem_low -= divisor_low;
+            q_low |= 1U;
+        }
+    }
 
-    return impl::from_words<T>(q);
+    // e = divisor - remainder
+    const auto e_high {divisor_high - rem_high - static_cast<std::uint64_t>(divisor_low < rem_low)};
+    const auto e_low {divisor_low - rem_low};
+    const bool e_fits {floor_log2 >= 64 ? e_high < (UINT64_C(1) << (floor_log2 - 64)) :
+                                          e_high == 0U && e_low < (UINT64_C(1) << floor_log2)};
+
+    bool needs_add {false};
+    if (!e_fits)
+    {
+        // Use one more bit of precision, which no longer fits in 128-bits,
+        // so the missing bit is added back in at runtime
+        needs_add = true;
+
+        q_high = (q_high << 1U) | (q_low >> 63U);
+        q_low <<= 1U;
+
+        const bool twice_rem_carry {(rem_high >> 63U) != 0U};
+        const auto twice_rem_high {(rem_high << 1U) | (rem_low >> 63U)};
+        const auto twice_rem_low {rem_low << 1U};
+
+        if (twice_rem_carry || twice_rem_high > divisor_high || (twice_rem_high == divisor_high && twice_rem_low >= divisor_low))
+        {
+            ++q_low;
+            q_high += static_cast<std::uint64_t>(q_low == 0U);
+        }
+    }
+
+    ++q_low;
+    q_high += static_cast<std::uint64_t>(q_low == 0U);
+
+    return constant_divisor_magic{q_high, q_low, floor_log2, false, needs_add};
 }
 
-#ifdef _MSC_VER
-#  pragma warning(pop)
-#endif
+template <std::uint64_t divisor_high, std::uint64_t divisor_low, typename T>
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr T div_by_constant(const T& lhs) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    static_assert(divisor_high != 0U || divisor_low != 0U, "Division by 0");
+
+    constexpr auto magic {make_constant_divisor_magic(divisor_high, divisor_low)};
+
+    const auto lhs_high {static_cast<std::uint64_t>(lhs.high)};
+    const auto lhs_low {lhs.low};
+
+    BOOST_INT128_IF_CONSTEXPR (magic.is_power_of_two)
+    {
+        return lhs >> magic.shift;
+    }
+    else
+    {
+        std::uint64_t words[4] {};
+        umul128_words(magic.magic_high, magic.magic_low, lhs_high, lhs_low, words);
+
+        auto q_high {words[3]};
+        auto q_low {words[2]};
+
+        BOOST_INT128_IF_CONSTEXPR (magic.needs_add)
+        {
+            // t = ((lhs - q) >> 1) + q, which cannot overflow
+            auto t_high {lhs_high - q_high - static_cast<std::uint64_t>(lhs_low < q_low)};
+            auto t_low {lhs_low - q_low};
+            t_low = (t_low >> 1U) | (t_high << 63U);
+            t_high >>= 1U;
+
+            t_low += q_low;
+            q_high = t_high + q_high + static_cast<std::uint64_t>(t_low < q_low);
+            q_low = t_low;
+        }
+
+        return T{static_cast<high_word_type>(q_high), q_low} >> magic.shift;
+    }
+}
+
+template <std::uint64_t divisor_high, std::uint64_t divisor_low, typename T>
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr T mod_by_constant(const T& lhs) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    constexpr T divisor {static_cast<high_word_type>(divisor_high), divisor_low};
+
+    return lhs - div_by_constant<divisor_high, divisor_low>(lhs) * divisor;
+}
 
 #if defined(__clang__)
 #  pragma clang diagnostic pop
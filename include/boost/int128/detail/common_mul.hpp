@@ -18,29 +18,72 @@ namespace boost {
 namespace int128 {
 namespace detail {
 
+#ifdef BOOST_INT128_HAS_UMAAL
+
+// hi:lo = lhs * rhs + lo + hi, which cannot overflow 64 bits
+BOOST_INT128_FORCE_INLINE void umaal(std::uint32_t& lo, std::uint32_t& hi, const std::uint32_t lhs, const std::uint32_t rhs) noexcept
+{
+    __asm__("umaal %[lo], %[hi], %[lhs], %[rhs]" : [lo] "+r"(lo), [hi] "+r"(hi) : [lhs] "r"(lhs), [rhs] "r"(rhs));
+}
+
+template <typename ReturnType, std::size_t u_size, std::size_t v_size>
+BOOST_INT128_FORCE_INLINE ReturnType umaal_multiply(const std::uint32_t (&u)[u_size], const std::uint32_t (&v)[v_size]) noexcept
+{
+    using high_word_type = decltype(ReturnType{}.high);
+
+    std::uint32_t w[4] {};
+
+    for (std::size_t j {}; j < v_size; ++j)
+    {
+        std::uint32_t carry {};
+        for (std::size_t i {}; i < u_size && i + j < 4U; ++i)
+        {
+            umaal(w[i + j], carry, u[i], v[j]);
+        }
+
+        if (j + u_size < 4U)
+        {
+            w[j + u_size] = carry;
+        }
+    }
+
+    const auto low {static_cast<std::uint64_t>(w[0]) | (static_cast<std::uint64_t>(w[1]) << 32)};
+    const auto high {static_cast<std::uint64_t>(w[2]) | (static_cast<std::uint64_t>(w[3]) << 32)};
+
+    return {static_cast<high_word_type>(high), low};
+}
+
+#endif // BOOST_INT128_HAS_UMAAL
+
 // See: The Art of Computer Programming Volume 2 (Semi-numerical algorithms) section 4.3.1
 // Algorithm M: Multiplication of Non-negative integers
+//
+// Only the low 128 bits of the product are returned, so only the partial products u[i] * v[j] with i + j < 4
+// are formed, which for two full values is 10 of the 16. The zero test of M.2 is left out as well,
+// since a branch on the data costs more than the multiplications it would save
 template <typename ReturnType, std::size_t u_size, std::size_t v_size>
 BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr ReturnType knuth_multiply(const std::uint32_t (&u)[u_size],
                                                               const std::uint32_t (&v)[v_size]) noexcept
 {
+    #if defined(BOOST_INT128_HAS_UMAAL) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(u))
+    {
+        return umaal_multiply<ReturnType>(u, v);
+    }
+
+    #endif
+
     using high_word_type = decltype(ReturnType{}.high);
 
-    std::uint32_t w[u_size + v_size] {};
+    std::uint32_t w[4] {};
 
     // M.1
     for (std::size_t j {}; j < v_size; ++j)
     {
-        // M.2
-        if (v[j] == 0)
-        {
-            w[j + u_size] = 0;
-            continue;
-        }
-
         // M.3
         std::uint64_t t {};
-        for (std::size_t i {}; i < u_size; ++i)
+        for (std::size_t i {}; i < u_size && i + j < 4U; ++i)
         {
             // M.4
             t += static_cast<std::uint64_t>(u[i]) * v[j] + w[i + j];
@@ -49,7 +92,10 @@ BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr ReturnType knuth_mu
         }
 
         // M.5
-        w[j + u_size] = static_cast<std::uint32_t>(t);
+        if (j + u_size < 4U)
+        {
+            w[j + u_size] = static_cast<std::uint32_t>(t);
+        }
     }
 
     const auto low {static_cast<std::uint64_t>(w[0]) | (static_cast<std::uint64_t>(w[1]) << 32)};
@@ -99,6 +145,121 @@ BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr void to_words(const
     words[0] = x;
 }
 
+// Full 64x64 -> 128-bit product
+// Returns the low word, and the high word is written into high
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr std::uint64_t umul64(const std::uint64_t lhs, const std::uint64_t rhs, std::uint64_t& high) noexcept
+{
+    #ifdef BOOST_INT128_HAS_INT128
+
+    const auto res {static_cast<builtin_u128>(lhs) * static_cast<builtin_u128>(rhs)};
+    high = static_cast<std::uint64_t>(res >> 64U);
+    return static_cast<std::uint64_t>(res);
+
+    #else
+
+    #  if defined(_M_AMD64) && !defined(__GNUC__) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+    {
+        return _umul128(lhs, rhs, &high);
+    }
+
+    #  elif defined(_M_ARM64) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+    {
+        high = __umulh(lhs, rhs);
+        return lhs * rhs;
+    }
+
+    #  endif
+
+    const auto a_lo {lhs & UINT32_MAX};
+    const auto a_hi {lhs >> 32U};
+    const auto b_lo {rhs & UINT32_MAX};
+    const auto b_hi {rhs >> 32U};
+
+    const auto lo_lo {a_lo * b_lo};
+    const auto hi_lo {a_hi * b_lo};
+    const auto lo_hi {a_lo * b_hi};
+    const auto hi_hi {a_hi * b_hi};
+
+    // Cannot overflow: (2^32 - 1) + (2^32 - 1) + (2^32 - 1)^2 < 2^64
+    const auto cross {(lo_lo >> 32U) + (hi_lo & UINT32_MAX) + lo_hi};
+
+    high = hi_hi + (hi_lo >> 32U) + (cross >> 32U);
+    return (cross << 32U) | (lo_lo & UINT32_MAX);
+
+    #endif
+}
+
+// Full 128x128 -> 256-bit product of (lhs_high, lhs_low) and (rhs_high, rhs_low)
+// words[0] receives the least significant word of the result
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr void umul128_words(const std::uint64_t lhs_high, const std::uint64_t lhs_low,
+                                                                               const std::uint64_t rhs_high, const std::uint64_t rhs_low,
+                                                                               std::uint64_t (&words)[4]) noexcept
+{
+    std::uint64_t low_low_high {};
+    words[0] = umul64(lhs_low, rhs_low, low_low_high);
+
+    std::uint64_t low_high_high {};
+    const auto low_high_low {umul64(lhs_low, rhs_high, low_high_high)};
+
+    std::uint64_t high_low_high {};
+    const auto high_low_low {umul64(lhs_high, rhs_low, high_low_high)};
+
+    std::uint64_t high_high_high {};
+    const auto high_high_low {umul64(lhs_high, rhs_high, high_high_high)};
+
+    auto word1 {low_low_high + low_high_low};
+    auto carry {static_cast<std::uint64_t>(word1 < low_high_low)};
+    word1 += high_low_low;
+    carry += static_cast<std::uint64_t>(word1 < high_low_low);
+
+    auto word2 {high_high_low + carry};
+    carry = static_cast<std::uint64_t>(word2 < carry);
+    word2 += low_high_high;
+    carry += static_cast<std::uint64_t>(word2 < low_high_high);
+    word2 += high_low_high;
+    carry += static_cast<std::uint64_t>(word2 < high_low_high);
+
+    words[1] = word1;
+    words[2] = word2;
+    words[3] = high_high_high + carry;
+}
+
+// Full 256-bit square of (high, low). The cross product high * low appears twice in the square,
+// so it is formed once and doubled with a shift, which saves one of the four products
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr void usqr128_words(const std::uint64_t high, const std::uint64_t low,
+                                                                               std::uint64_t (&words)[4]) noexcept
+{
+    std::uint64_t low_low_high {};
+    words[0] = umul64(low, low, low_low_high);
+
+    std::uint64_t cross_high {};
+    const auto cross_low {umul64(low, high, cross_high)};
+
+    std::uint64_t high_high_high {};
+    const auto high_high_low {umul64(high, high, high_high_high)};
+
+    // 2 * cross is 129 bits
+    const auto doubled0 {cross_low << 1U};
+    const auto doubled1 {(cross_high << 1U) | (cross_low >> 63U)};
+    const auto doubled2 {cross_high >> 63U};
+
+    const auto word1 {low_low_high + doubled0};
+    auto carry {static_cast<std::uint64_t>(word1 < doubled0)};
+
+    auto word2 {high_high_low + carry};
+    carry = static_cast<std::uint64_t>(word2 < carry);
+    word2 += doubled1;
+    carry += static_cast<std::uint64_t>(word2 < doubled1);
+
+    words[1] = word1;
+    words[2] = word2;
+    words[3] = high_high_high + doubled2 + carry;
+}
+
 } // namespace detail
 } // namespace int128
 } // namespace boost
@@ -169,6 +169,22 @@ using builtin_u128 = std::_Unsigned128;
 
 #endif // Platform macros
 
+// GCC and Clang on x86-64 can use the 128/64 divide instruction through inline assembly
+// instead of the __udivti3/__umodti3 libcalls. Define BOOST_INT128_NO_INLINE_DIVQ to opt out
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(BOOST_INT128_NO_INLINE_DIVQ) && !(defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA))
+#  define BOOST_INT128_HAS_INLINE_DIVQ
+#endif
+
+// UMAAL (hi:lo = a * b + lo + hi) is exactly one step of schoolbook multiplication.
+// It exists in ARM state from ARMv6, and in Thumb-2 outside of the M profile cores without the DSP extension.
+// Define BOOST_INT128_NO_UMAAL to opt out
+#if defined(__arm__) && (defined(__GNUC__) || defined(__clang__)) && defined(__ARM_ARCH) && __ARM_ARCH >= 6 && \
+    (!defined(__thumb__) || defined(__thumb2__)) && \
+    !(defined(__ARM_ARCH_PROFILE) && __ARM_ARCH_PROFILE == 'M' && !defined(__ARM_FEATURE_DSP)) && \
+    !defined(BOOST_INT128_NO_UMAAL) && !(defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA))
+#  define BOOST_INT128_HAS_UMAAL
+#endif
+
 // The builtin is only constexpr from clang-7 or GCC-10
 #ifdef __has_builtin
 #  if __has_builtin(__builtin_sub_overflow) && ((defined(__clang__) && __clang_major__ >= 7) || (defined(__GNUC__) && __GNUC__ >= 10))
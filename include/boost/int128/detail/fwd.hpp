@@ -12,6 +12,8 @@ namespace int128 {
 
 BOOST_INT128_EXPORT struct uint128_t;
 BOOST_INT128_EXPORT struct int128_t;
+BOOST_INT128_EXPORT struct uint256_t;
+BOOST_INT128_EXPORT struct int256_t;
 
 } // namespace int128
 } // namespace boost
@@ -0,0 +1,575 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_DETAIL_INT256_IMP_HPP
+#define BOOST_INT128_DETAIL_INT256_IMP_HPP
+
+#include <boost/int128/detail/fwd.hpp>
+#include <boost/int128/detail/config.hpp>
+#include <boost/int128/detail/traits.hpp>
+#include <boost/int128/detail/constants.hpp>
+#include <boost/int128/detail/uint128_imp.hpp>
+#include <boost/int128/detail/int128_imp.hpp>
+#include <boost/int128/detail/uint256_imp.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstdint>
+#include <limits>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+// Fixed width 256-bit two's complement integer. The arithmetic is carried out on the
+// unsigned representation, except for division and right shifts which depend on the sign
+BOOST_INT128_EXPORT struct int256_t
+{
+    #if BOOST_INT128_ENDIAN_LITTLE_BYTE
+    uint128_t low {};
+    int128_t high {};
+    #else
+
+    #ifdef __GNUC__
+    #  pragma GCC diagnostic push
+    #  pragma GCC diagnostic ignored "-Wreorder"
+    #endif
+
+    int128_t high {};
+    uint128_t low {};
+
+    #ifdef __GNUC__
+    #  pragma GCC diagnostic pop
+    #endif
+
+    #endif // BOOST_INT128_ENDIAN_LITTLE_BYTE
+
+    // Defaulted basic construction
+    constexpr int256_t() noexcept = default;
+    constexpr int256_t(const int256_t&) noexcept = default;
+    constexpr int256_t(int256_t&&) noexcept = default;
+    constexpr int256_t& operator=(const int256_t&) noexcept = default;
+    constexpr int256_t& operator=(int256_t&&) noexcept = default;
+
+    // Requires a conversion file to be implemented
+    BOOST_INT128_HOST_DEVICE explicit constexpr int256_t(const uint256_t& v) noexcept;
+
+    // Construct from integral types
+    #if BOOST_INT128_ENDIAN_LITTLE_BYTE
+
+    BOOST_INT128_HOST_DEVICE constexpr int256_t(const int128_t hi, const uint128_t lo) noexcept : low {lo}, high {hi} {}
+
+    #else
+
+    BOOST_INT128_HOST_DEVICE constexpr int256_t(const int128_t hi, const uint128_t lo) noexcept : high {hi}, low {lo} {}
+
+    #endif // BOOST_INT128_ENDIAN_LITTLE_BYTE
+
+    template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr int256_t(const SignedInteger v) noexcept :
+        int256_t {v < 0 ? int128_t{-1} : int128_t{0}, static_cast<uint128_t>(v)} {}
+
+    template <BOOST_INT128_DEFAULTED_UNSIGNED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr int256_t(const UnsignedInteger v) noexcept : int256_t {int128_t{0}, static_cast<uint128_t>(v)} {}
+
+    BOOST_INT128_HOST_DEVICE constexpr int256_t(const int128_t v) noexcept :
+        int256_t {v < 0 ? int128_t{-1} : int128_t{0}, static_cast<uint128_t>(v)} {}
+
+    BOOST_INT128_HOST_DEVICE constexpr int256_t(const uint128_t v) noexcept : int256_t {int128_t{0}, v} {}
+
+    // Integer conversion operators
+    BOOST_INT128_HOST_DEVICE explicit constexpr operator bool() const noexcept { return static_cast<bool>(low) || static_cast<bool>(high); }
+
+    template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE explicit constexpr operator SignedInteger() const noexcept { return static_cast<SignedInteger>(low); }
+
+    template <BOOST_INT128_DEFAULTED_UNSIGNED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE explicit constexpr operator UnsignedInteger() const noexcept { return static_cast<UnsignedInteger>(low); }
+
+    // Conversion to float
+    // This is basically the same as ldexp(static_cast<T>(high), 128) + static_cast<T>(low),
+    // but can be constexpr at C++11 instead of C++26
+    BOOST_INT128_HOST_DEVICE explicit constexpr operator float() const noexcept;
+    BOOST_INT128_HOST_DEVICE explicit constexpr operator double() const noexcept;
+
+    // Long double does not exist on device
+    #if !(defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA))
+    explicit constexpr operator long double() const noexcept;
+    #endif
+
+    // Compound operators
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator|=(int256_t rhs) noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator&=(int256_t rhs) noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator^=(int256_t rhs) noexcept;
+
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator<<=(Integer rhs) noexcept;
+
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator>>=(Integer rhs) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator++() noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr int256_t operator++(int) noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator--() noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr int256_t operator--(int) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator+=(int256_t rhs) noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator-=(int256_t rhs) noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator*=(int256_t rhs) noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator/=(int256_t rhs) noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr int256_t& operator%=(int256_t rhs) noexcept;
+};
+
+namespace detail {
+
+// Reinterpret between the two 256-bit types without going through the conversion file
+
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr uint256_t int256_bits(const int256_t value) noexcept
+{
+    return {static_cast<uint128_t>(value.high), value.low};
+}
+
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr int256_t int256_from_bits(const uint256_t value) noexcept
+{
+    return {static_cast<int128_t>(value.high), value.low};
+}
+
+} // namespace detail
+
+//=====================================
+// Absolute Value function
+//=====================================
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t abs(const int256_t value) noexcept
+{
+    return value.high < 0 ? detail::int256_from_bits(-detail::int256_bits(value)) : value;
+}
+
+//=====================================
+// Float Conversion Operators
+//=====================================
+
+// Converted through the magnitude, since for small negative values high * 2^128 and low
+// are both close to 2^256 and their sum cancels to nothing in floating point
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t::operator float() const noexcept
+{
+    const auto magnitude {static_cast<float>(high < 0 ? -detail::int256_bits(*this) : detail::int256_bits(*this))};
+    return high < 0 ? -magnitude : magnitude;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t::operator double() const noexcept
+{
+    const auto magnitude {static_cast<double>(high < 0 ? -detail::int256_bits(*this) : detail::int256_bits(*this))};
+    return high < 0 ? -magnitude : magnitude;
+}
+
+#if !(defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA))
+
+constexpr int256_t::operator long double() const noexcept
+{
+    const auto magnitude {static_cast<long double>(high < 0 ? -detail::int256_bits(*this) : detail::int256_bits(*this))};
+    return high < 0 ? -magnitude : magnitude;
+}
+
+#endif
+
+//=====================================
+// Unary Operators
+//=====================================
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t operator+(const int256_t value) noexcept
+{
+    return value;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t operator-(const int256_t value) noexcept
+{
+    return detail::int256_from_bits(-detail::int256_bits(value));
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t operator~(const int256_t value) noexcept
+{
+    return {~value.high, ~value.low};
+}
+
+//=====================================
+// Comparison Operators
+//=====================================
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator==(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return lhs.low == rhs.low && lhs.high == rhs.high;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator!=(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator<(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return lhs.high == rhs.high ? lhs.low < rhs.low : lhs.high < rhs.high;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator<=(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return !(rhs < lhs);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator>(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return rhs < lhs;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator>=(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return !(lhs < rhs);
+}
+
+#ifdef BOOST_INT128_HAS_SPACESHIP_OPERATOR
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr std::strong_ordering operator<=>(const int256_t lhs, const int256_t rhs) noexcept
+{
+    if (lhs < rhs)
+    {
+        return std::strong_ordering::less;
+    }
+    else if (lhs == rhs)
+    {
+        return std::strong_ordering::equivalent;
+    }
+    else
+    {
+        return std::strong_ordering::greater;
+    }
+}
+
+#endif // BOOST_INT128_HAS_SPACESHIP_OPERATOR
+
+//=====================================
+// Bitwise Operators
+//=====================================
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t operator|(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return {lhs.high | rhs.high, lhs.low | rhs.low};
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t operator&(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return {lhs.high & rhs.high, lhs.low & rhs.low};
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t operator^(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return {lhs.high ^ rhs.high, lhs.low ^ rhs.low};
+}
+
+//=====================================
+// Shift Operators
+//=====================================
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr int256_t operator<<(const int256_t lhs, const Integer rhs) noexcept
+{
+    return detail::int256_from_bits(detail::int256_bits(lhs) << rhs);
+}
+
+// Arithmetic shift. Shifting by a negative amount, or by the width of the type or more
+// leaves only the sign, as with int128_t
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr int256_t operator>>(const int256_t lhs, const Integer rhs) noexcept
+{
+    const int128_t sign {lhs.high < 0 ? -1 : 0};
+
+    if (detail::is_out_of_range_u256_shift(rhs))
+    {
+        return {sign, static_cast<uint128_t>(sign)};
+    }
+
+    const auto shift {static_cast<unsigned>(rhs)};
+
+    if (shift >= 128U)
+    {
+        return {sign, static_cast<uint128_t>(lhs.high >> (shift - 128U))};
+    }
+
+    // The shift of the high half by 128 - 0 == 128 is defined to give zero
+    return {lhs.high >> shift, (lhs.low >> shift) | (static_cast<uint128_t>(lhs.high) << (128U - shift))};
+}
+
+//=====================================
+// Arithmetic Operators
+//=====================================
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t operator+(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return detail::int256_from_bits(detail::int256_bits(lhs) + detail::int256_bits(rhs));
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t operator-(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return detail::int256_from_bits(detail::int256_bits(lhs) - detail::int256_bits(rhs));
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t operator*(const int256_t lhs, const int256_t rhs) noexcept
+{
+    return detail::int256_from_bits(detail::int256_bits(lhs) * detail::int256_bits(rhs));
+}
+
+namespace detail {
+
+// Truncating division on the magnitudes. The remainder takes the sign of the dividend
+BOOST_INT128_HOST_DEVICE constexpr int256_t div_mod_i256(const int256_t lhs, const int256_t rhs, int256_t& remainder) noexcept
+{
+    const auto negative_lhs {lhs.high < 0};
+    const auto negative_rhs {rhs.high < 0};
+
+    const auto abs_lhs {negative_lhs ? -int256_bits(lhs) : int256_bits(lhs)};
+    const auto abs_rhs {negative_rhs ? -int256_bits(rhs) : int256_bits(rhs)};
+
+    uint256_t abs_remainder {};
+    const auto abs_quotient {div_mod_u256(abs_lhs, abs_rhs, abs_remainder)};
+
+    remainder = int256_from_bits(negative_lhs ? -abs_remainder : abs_remainder);
+    return int256_from_bits(negative_lhs != negative_rhs ? -abs_quotient : abs_quotient);
+}
+
+} // namespace detail
+
+// Division by zero gives zero, as with int128_t
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t operator/(const int256_t lhs, const int256_t rhs) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(rhs == 0))
+    {
+        return {0, 0U};
+    }
+
+    int256_t remainder {};
+    return detail::div_mod_i256(lhs, rhs, remainder);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int256_t operator%(const int256_t lhs, const int256_t rhs) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(rhs == 0))
+    {
+        return {0, 0U};
+    }
+
+    int256_t remainder {};
+    static_cast<void>(detail::div_mod_i256(lhs, rhs, remainder));
+    return remainder;
+}
+
+//=====================================
+// Compound Operators
+//=====================================
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator|=(const int256_t rhs) noexcept
+{
+    *this = *this | rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator&=(const int256_t rhs) noexcept
+{
+    *this = *this & rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator^=(const int256_t rhs) noexcept
+{
+    *this = *this ^ rhs;
+    return *this;
+}
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator<<=(const Integer rhs) noexcept
+{
+    *this = *this << rhs;
+    return *this;
+}
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator>>=(const Integer rhs) noexcept
+{
+    *this = *this >> rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator++() noexcept
+{
+    *this = *this + 1;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t int256_t::operator++(int) noexcept
+{
+    const auto temp {*this};
+    ++(*this);
+    return temp;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator--() noexcept
+{
+    *this = *this - 1;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t int256_t::operator--(int) noexcept
+{
+    const auto temp {*this};
+    --(*this);
+    return temp;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator+=(const int256_t rhs) noexcept
+{
+    *this = *this + rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator-=(const int256_t rhs) noexcept
+{
+    *this = *this - rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator*=(const int256_t rhs) noexcept
+{
+    *this = *this * rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator/=(const int256_t rhs) noexcept
+{
+    *this = *this / rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t& int256_t::operator%=(const int256_t rhs) noexcept
+{
+    *this = *this % rhs;
+    return *this;
+}
+
+namespace detail {
+
+template <bool>
+class numeric_limits_impl_i256
+{
+public:
+
+    // Member constants
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = true;
+    static constexpr bool is_exact = true;
+    static constexpr bool has_infinity = false;
+    static constexpr bool has_quiet_NaN = false;
+    static constexpr bool has_signaling_NaN = false;
+
+    // C++23 deprecated the following two members
+    #if defined(__GNUC__) && __cplusplus > 202002L
+    #  pragma GCC diagnostic push
+    #  pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+    #elif defined(_MSC_VER)
+    #  pragma warning(push)
+    #  pragma warning(disable:4996)
+    #endif
+
+    static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+    static constexpr bool has_denorm_loss = false;
+
+    #if defined(__GNUC__) && __cplusplus > 202002L
+    #  pragma GCC diagnostic pop
+    #elif defined(_MSC_VER)
+    #  pragma warning(pop)
+    #endif
+
+    static constexpr std::float_round_style round_style = std::round_toward_zero;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = true;
+    static constexpr int digits = 255;
+    static constexpr int digits10 = 76;
+    static constexpr int max_digits10 = 0;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = 0;
+    static constexpr int min_exponent10 = 0;
+    static constexpr int max_exponent = 0;
+    static constexpr int max_exponent10 = 0;
+    static constexpr bool traps = std::numeric_limits<std::uint64_t>::traps;
+    static constexpr bool tinyness_before = false;
+
+    // Member functions
+    BOOST_INT128_HOST_DEVICE static constexpr auto (min)        () -> boost::int128::int256_t { return {int128_t{INT64_MIN, 0}, uint128_t{0U}}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto lowest       () -> boost::int128::int256_t { return {int128_t{INT64_MIN, 0}, uint128_t{0U}}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto (max)        () -> boost::int128::int256_t { return {int128_t{INT64_MAX, UINT64_MAX}, uint128_t{UINT64_MAX, UINT64_MAX}}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto epsilon      () -> boost::int128::int256_t { return {0, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto round_error  () -> boost::int128::int256_t { return {0, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto infinity     () -> boost::int128::int256_t { return {0, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto quiet_NaN    () -> boost::int128::int256_t { return {0, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto signaling_NaN() -> boost::int128::int256_t { return {0, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto denorm_min   () -> boost::int128::int256_t { return {0, 0U}; }
+};
+
+#if !defined(__cpp_inline_variables) || __cpp_inline_variables < 201606L
+
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::is_specialized;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::is_signed;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::is_integer;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::is_exact;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::has_infinity;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::has_quiet_NaN;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::has_signaling_NaN;
+
+// These members were deprecated in C++23
+#if ((!defined(_MSC_VER) && (__cplusplus <= 202002L)) || (defined(_MSC_VER) && (_MSVC_LANG <= 202002L)))
+template <bool b> constexpr std::float_denorm_style numeric_limits_impl_i256<b>::has_denorm;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::has_denorm_loss;
+#endif
+
+template <bool b> constexpr std::float_round_style numeric_limits_impl_i256<b>::round_style;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::is_iec559;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::is_bounded;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::is_modulo;
+template <bool b> constexpr int numeric_limits_impl_i256<b>::digits;
+template <bool b> constexpr int numeric_limits_impl_i256<b>::digits10;
+template <bool b> constexpr int numeric_limits_impl_i256<b>::max_digits10;
+template <bool b> constexpr int numeric_limits_impl_i256<b>::radix;
+template <bool b> constexpr int numeric_limits_impl_i256<b>::min_exponent;
+template <bool b> constexpr int numeric_limits_impl_i256<b>::min_exponent10;
+template <bool b> constexpr int numeric_limits_impl_i256<b>::max_exponent;
+template <bool b> constexpr int numeric_limits_impl_i256<b>::max_exponent10;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::traps;
+template <bool b> constexpr bool numeric_limits_impl_i256<b>::tinyness_before;
+
+#endif // !defined(__cpp_inline_variables) || __cpp_inline_variables < 201606L
+
+} // namespace detail
+
+} // namespace int128
+} // namespace boost
+
+namespace std {
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wmismatched-tags"
+#endif
+
+template <>
+class numeric_limits<boost::int128::int256_t> :
+    public boost::int128::detail::numeric_limits_impl_i256<true> {};
+
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+} // namespace std
+
+#endif // BOOST_INT128_DETAIL_INT256_IMP_HPP
@@ -8,6 +8,7 @@
 
 #include <boost/int128/detail/uint128_imp.hpp>
 #include <boost/int128/detail/int128_imp.hpp>
+#include <boost/int128/int256.hpp>
 
 #ifndef BOOST_INT128_BUILD_MODULE
 
@@ -127,7 +128,6 @@ BOOST_INT128_HOST_DEVICE constexpr int from_chars_integer_impl(const char* first
 
 
     overflow_value /= unsigned_base;
-    overflow_value <<= 1;
     max_digit %= unsigned_base;
 
     // If the only character was a sign abort now
@@ -139,7 +139,8 @@ BOOST_INT128_HOST_DEVICE constexpr int from_chars_integer_impl(const char* first
     bool overflowed = false;
 
     std::ptrdiff_t nc = last - next;
-    constexpr std::ptrdiff_t nd = std::numeric_limits<Integer>::digits10;
+    // digits10 characters can only be accumulated without checking in base 10 or below
+    const std::ptrdiff_t nd = base <= 10 ? std::numeric_limits<Integer>::digits10 : 0;
 
     {
         std::ptrdiff_t i = 0;
@@ -215,6 +216,16 @@ BOOST_INT128_HOST_DEVICE constexpr int from_chars(const char* first, const char*
     return impl::from_chars_integer_impl<int128_t, uint128_t>(first, last, value, base);
 }
 
+BOOST_INT128_HOST_DEVICE constexpr int from_chars(const char* first, const char* last, uint256_t& value, int base = 10) noexcept
+{
+    return impl::from_chars_integer_impl<uint256_t, uint256_t>(first, last, value, base);
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int from_chars(const char* first, const char* last, int256_t& value, int base = 10) noexcept
+{
+    return impl::from_chars_integer_impl<int256_t, uint256_t>(first, last, value, base);
+}
+
 } // namespace detail
 } // namespace int128
 } // namespace boost
@@ -7,6 +7,7 @@
 #define BOOST_INT128_DETAIL_MINI_TO_CHARS_HPP
 
 #include <boost/int128/int128.hpp>
+#include <boost/int128/int256.hpp>
 
 namespace boost {
 namespace int128 {
@@ -124,6 +125,82 @@ BOOST_INT128_HOST_DEVICE constexpr char* mini_to_chars(char (&buffer)[64], const
     return p;
 }
 
+// Peels off chunks of as many digits as fit in a 64-bit word, so that only one 256-bit division
+// is required per chunk rather than per digit. Each chunk and the final 128 bits are rendered by the overload above.
+// The buffer holds the octal representation with a prefix, so base 2 is not supported
+BOOST_INT128_HOST_DEVICE constexpr char* mini_to_chars(char (&buffer)[128], uint256_t v, const int base, const bool uppercase) noexcept
+{
+    std::uint64_t chunk_divisor {};
+    int chunk_digits {};
+
+    switch (base)
+    {
+        case 8:
+            chunk_divisor = UINT64_C(1) << 63U;
+            chunk_digits = 21;
+            break;
+
+        case 10:
+            chunk_divisor = UINT64_C(10000000000000000000);
+            chunk_digits = 19;
+            break;
+
+        case 16:
+            chunk_divisor = UINT64_C(1) << 60U;
+            chunk_digits = 15;
+            break;
+
+        default:                        // LCOV_EXCL_LINE
+            BOOST_INT128_UNREACHABLE;   // LCOV_EXCL_LINE
+    }
+
+    char* last {buffer + 128U};
+    *--last = '\0';
+
+    char digits[64] {};
+
+    while (v.high != 0U)
+    {
+        uint256_t remainder {};
+        v = div_mod_u256(v, chunk_divisor, remainder);
+
+        const auto first {mini_to_chars(digits, remainder.low, base, uppercase)};
+        for (auto p {digits + 63}; p != first;)
+        {
+            *--last = *--p;
+        }
+
+        // Chunks below the leading one keep their leading zeros
+        for (auto written {digits + 63 - first}; written < chunk_digits; ++written)
+        {
+            *--last = '0';
+        }
+    }
+
+    // After any chunk has been peeled off, v is still at least 2^64 so no spurious zero is written here
+    const auto first {mini_to_chars(digits, v.low, base, uppercase)};
+    for (auto p {digits + 63}; p != first;)
+    {
+        *--last = *--p;
+    }
+
+    return last;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr char* mini_to_chars(char (&buffer)[128], const int256_t v, const int base, const bool uppercase) noexcept
+{
+    // The unsigned negation of the minimum value gives its magnitude
+    const auto magnitude {v < 0 ? -detail::int256_bits(v) : detail::int256_bits(v)};
+    auto p {mini_to_chars(buffer, magnitude, base, uppercase)};
+
+    if (v < 0)
+    {
+        *--p = '-';
+    }
+
+    return p;
+}
+
 } // namespace detail
 } // namespace int128
 } // namespace boost
@@ -0,0 +1,129 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_DETAIL_POW10_HPP
+#define BOOST_INT128_DETAIL_POW10_HPP
+
+#include <boost/int128/detail/config.hpp>
+#include <boost/int128/detail/uint128_imp.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstdint>
+#include <cstddef>
+
+#endif
+
+namespace boost {
+namespace int128 {
+namespace detail {
+
+#if !(defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA))
+
+// Every power of ten that fits into 128 bits
+BOOST_INT128_INLINE_CONSTEXPR uint128_t int128_pow10[39] =
+{
+    uint128_t{UINT64_C(0x0), UINT64_C(0x1)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0xa)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x64)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x3e8)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x2710)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x186a0)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0xf4240)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x989680)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x5f5e100)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x3b9aca00)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x2540be400)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x174876e800)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0xe8d4a51000)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x9184e72a000)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x5af3107a4000)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x38d7ea4c68000)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x2386f26fc10000)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x16345785d8a0000)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0xde0b6b3a7640000)},
+    uint128_t{UINT64_C(0x0), UINT64_C(0x8ac7230489e80000)},
+    uint128_t{UINT64_C(0x5), UINT64_C(0x6bc75e2d63100000)},
+    uint128_t{UINT64_C(0x36), UINT64_C(0x35c9adc5dea00000)},
+    uint128_t{UINT64_C(0x21e), UINT64_C(0x19e0c9bab2400000)},
+    uint128_t{UINT64_C(0x152d), UINT64_C(0x2c7e14af6800000)},
+    uint128_t{UINT64_C(0xd3c2), UINT64_C(0x1bcecceda1000000)},
+    uint128_t{UINT64_C(0x84595), UINT64_C(0x161401484a000000)},
+    uint128_t{UINT64_C(0x52b7d2), UINT64_C(0xdcc80cd2e4000000)},
+    uint128_t{UINT64_C(0x33b2e3c), UINT64_C(0x9fd0803ce8000000)},
+    uint128_t{UINT64_C(0x204fce5e), UINT64_C(0x3e25026110000000)},
+    uint128_t{UINT64_C(0x1431e0fae), UINT64_C(0x6d7217caa0000000)},
+    uint128_t{UINT64_C(0xc9f2c9cd0), UINT64_C(0x4674edea40000000)},
+    uint128_t{UINT64_C(0x7e37be2022), UINT64_C(0xc0914b2680000000)},
+    uint128_t{UINT64_C(0x4ee2d6d415b), UINT64_C(0x85acef8100000000)},
+    uint128_t{UINT64_C(0x314dc6448d93), UINT64_C(0x38c15b0a00000000)},
+    uint128_t{UINT64_C(0x1ed09bead87c0), UINT64_C(0x378d8e6400000000)},
+    uint128_t{UINT64_C(0x13426172c74d82), UINT64_C(0x2b878fe800000000)},
+    uint128_t{UINT64_C(0xc097ce7bc90715), UINT64_C(0xb34b9f1000000000)},
+    uint128_t{UINT64_C(0x785ee10d5da46d9), UINT64_C(0xf436a000000000)},
+    uint128_t{UINT64_C(0x4b3b4ca85a86c47a), UINT64_C(0x98a224000000000)}
+};
+
+#endif // __NVCC__
+
+// 10^n for 0 <= n <= 38
+BOOST_INT128_HOST_DEVICE constexpr uint128_t pow10(const int n) noexcept
+{
+    #if defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA)
+
+    constexpr uint128_t int128_pow10[39] =
+    {
+        uint128_t{UINT64_C(0x0), UINT64_C(0x1)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0xa)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x64)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x3e8)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x2710)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x186a0)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0xf4240)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x989680)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x5f5e100)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x3b9aca00)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x2540be400)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x174876e800)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0xe8d4a51000)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x9184e72a000)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x5af3107a4000)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x38d7ea4c68000)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x2386f26fc10000)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x16345785d8a0000)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0xde0b6b3a7640000)},
+        uint128_t{UINT64_C(0x0), UINT64_C(0x8ac7230489e80000)},
+        uint128_t{UINT64_C(0x5), UINT64_C(0x6bc75e2d63100000)},
+        uint128_t{UINT64_C(0x36), UINT64_C(0x35c9adc5dea00000)},
+        uint128_t{UINT64_C(0x21e), UINT64_C(0x19e0c9bab2400000)},
+        uint128_t{UINT64_C(0x152d), UINT64_C(0x2c7e14af6800000)},
+        uint128_t{UINT64_C(0xd3c2), UINT64_C(0x1bcecceda1000000)},
+        uint128_t{UINT64_C(0x84595), UINT64_C(0x161401484a000000)},
+        uint128_t{UINT64_C(0x52b7d2), UINT64_C(0xdcc80cd2e4000000)},
+        uint128_t{UINT64_C(0x33b2e3c), UINT64_C(0x9fd0803ce8000000)},
+        uint128_t{UINT64_C(0x204fce5e), UINT64_C(0x3e25026110000000)},
+        uint128_t{UINT64_C(0x1431e0fae), UINT64_C(0x6d7217caa0000000)},
+        uint128_t{UINT64_C(0xc9f2c9cd0), UINT64_C(0x4674edea40000000)},
+        uint128_t{UINT64_C(0x7e37be2022), UINT64_C(0xc0914b2680000000)},
+        uint128_t{UINT64_C(0x4ee2d6d415b), UINT64_C(0x85acef8100000000)},
+        uint128_t{UINT64_C(0x314dc6448d93), UINT64_C(0x38c15b0a00000000)},
+        uint128_t{UINT64_C(0x1ed09bead87c0), UINT64_C(0x378d8e6400000000)},
+        uint128_t{UINT64_C(0x13426172c74d82), UINT64_C(0x2b878fe800000000)},
+        uint128_t{UINT64_C(0xc097ce7bc90715), UINT64_C(0xb34b9f1000000000)},
+        uint128_t{UINT64_C(0x785ee10d5da46d9), UINT64_C(0xf436a000000000)},
+        uint128_t{UINT64_C(0x4b3b4ca85a86c47a), UINT64_C(0x98a224000000000)}
+    };
+
+    #endif // __NVCC__
+
+    BOOST_INT128_ASSUME(n >= 0 && n <= 38); // LCOV_EXCL_LINE
+
+    return int128_pow10[static_cast<std::size_t>(n)];
+}
+
+} // namespace detail
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_DETAIL_POW10_HPP
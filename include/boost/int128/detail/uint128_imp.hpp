@@ -3028,6 +3028,16 @@ BOOST_INT128_HOST_DEVICE constexpr uint128_t operator/(const uint128_t lhs, cons
     #if defined(BOOST_INT128_HAS_INT128) && !defined(__s390__) && !defined(__s390x__)
     else
     {
+        #if defined(BOOST_INT128_HAS_INLINE_DIVQ) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+        if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+        {
+            uint128_t remainder {};
+            return detail::div_mod_divq(lhs, rhs, remainder);
+        }
+
+        #endif
+
         return static_cast<uint128_t>(static_cast<detail::builtin_u128>(lhs) / static_cast<detail::builtin_u128>(rhs));
     }
     #else
@@ -3239,6 +3249,17 @@ BOOST_INT128_HOST_DEVICE constexpr uint128_t operator%(const uint128_t lhs, cons
     #if defined(BOOST_INT128_HAS_INT128) && !defined(__s390__) && !defined(__s390x__)
     else
     {
+        #if defined(BOOST_INT128_HAS_INLINE_DIVQ) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+        if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+        {
+            uint128_t remainder {};
+            detail::div_mod_divq(lhs, rhs, remainder);
+            return remainder;
+        }
+
+        #endif
+
         return static_cast<uint128_t>(static_cast<detail::builtin_u128>(lhs) % static_cast<detail::builtin_u128>(rhs));
     }
     #else
@@ -0,0 +1,942 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_DETAIL_UINT256_IMP_HPP
+#define BOOST_INT128_DETAIL_UINT256_IMP_HPP
+
+#include <boost/int128/detail/fwd.hpp>
+#include <boost/int128/detail/config.hpp>
+#include <boost/int128/detail/traits.hpp>
+#include <boost/int128/detail/constants.hpp>
+#include <boost/int128/detail/clz.hpp>
+#include <boost/int128/detail/common_mul.hpp>
+#include <boost/int128/detail/common_div.hpp>
+#include <boost/int128/detail/uint128_imp.hpp>
+#include <boost/int128/detail/int128_imp.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstdint>
+#include <limits>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+// Fixed width 256-bit unsigned integer stored as two uint128_t halves,
+// so that every operation is carried out by the 128-bit kernels
+BOOST_INT128_EXPORT struct uint256_t
+{
+    #if BOOST_INT128_ENDIAN_LITTLE_BYTE
+    uint128_t low {};
+    uint128_t high {};
+    #else
+
+    #ifdef __GNUC__
+    #  pragma GCC diagnostic push
+    #  pragma GCC diagnostic ignored "-Wreorder"
+    #endif
+
+    uint128_t high {};
+    uint128_t low {};
+
+    #ifdef __GNUC__
+    #  pragma GCC diagnostic pop
+    #endif
+
+    #endif // BOOST_INT128_ENDIAN_LITTLE_BYTE
+
+    // Defaulted basic construction
+    constexpr uint256_t() noexcept = default;
+    constexpr uint256_t(const uint256_t&) noexcept = default;
+    constexpr uint256_t(uint256_t&&) noexcept = default;
+    constexpr uint256_t& operator=(const uint256_t&) noexcept = default;
+    constexpr uint256_t& operator=(uint256_t&&) noexcept = default;
+
+    // Requires a conversion file to be implemented
+    BOOST_INT128_HOST_DEVICE explicit constexpr uint256_t(const int256_t& v) noexcept;
+
+    // Construct from integral types
+    #if BOOST_INT128_ENDIAN_LITTLE_BYTE
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t(const uint128_t hi, const uint128_t lo) noexcept : low {lo}, high {hi} {}
+
+    #else
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t(const uint128_t hi, const uint128_t lo) noexcept : high {hi}, low {lo} {}
+
+    #endif // BOOST_INT128_ENDIAN_LITTLE_BYTE
+
+    template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t(const SignedInteger v) noexcept :
+        uint256_t {v < 0 ? (std::numeric_limits<uint128_t>::max)() : uint128_t{0U}, static_cast<uint128_t>(v)} {}
+
+    template <BOOST_INT128_DEFAULTED_UNSIGNED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t(const UnsignedInteger v) noexcept : uint256_t {uint128_t{0U}, static_cast<uint128_t>(v)} {}
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t(const uint128_t v) noexcept : uint256_t {uint128_t{0U}, v} {}
+
+    // Sign extends, the same as the conversion from the builtin signed types
+    BOOST_INT128_HOST_DEVICE explicit constexpr uint256_t(const int128_t v) noexcept :
+        uint256_t {v < 0 ? (std::numeric_limits<uint128_t>::max)() : uint128_t{0U}, static_cast<uint128_t>(v)} {}
+
+    // Integer conversion operators
+    BOOST_INT128_HOST_DEVICE explicit constexpr operator bool() const noexcept { return static_cast<bool>(low) || static_cast<bool>(high); }
+
+    template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE explicit constexpr operator SignedInteger() const noexcept { return static_cast<SignedInteger>(low); }
+
+    template <BOOST_INT128_DEFAULTED_UNSIGNED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE explicit constexpr operator UnsignedInteger() const noexcept { return static_cast<UnsignedInteger>(low); }
+
+    // Conversion to float
+    // This is basically the same as ldexp(static_cast<T>(high), 128) + static_cast<T>(low),
+    // but can be constexpr at C++11 instead of C++26
+    BOOST_INT128_HOST_DEVICE explicit constexpr operator float() const noexcept;
+    BOOST_INT128_HOST_DEVICE explicit constexpr operator double() const noexcept;
+
+    // long doubles do not exist on device
+    #if !(defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA))
+    explicit constexpr operator long double() const noexcept;
+    #endif
+
+    // Compound operators
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator|=(Integer rhs) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator|=(uint256_t rhs) noexcept;
+
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator&=(Integer rhs) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator&=(uint256_t rhs) noexcept;
+
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator^=(Integer rhs) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator^=(uint256_t rhs) noexcept;
+
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator<<=(Integer rhs) noexcept;
+
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator>>=(Integer rhs) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator++() noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t operator++(int) noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator--() noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t operator--(int) noexcept;
+
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator+=(Integer rhs) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator+=(uint256_t rhs) noexcept;
+
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator-=(Integer rhs) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator-=(uint256_t rhs) noexcept;
+
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator*=(Integer rhs) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator*=(uint256_t rhs) noexcept;
+
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator/=(Integer rhs) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator/=(uint256_t rhs) noexcept;
+
+    template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator%=(Integer rhs) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint256_t& operator%=(uint256_t rhs) noexcept;
+};
+
+namespace detail {
+
+// Builtin signed operands are only accepted under BOOST_INT128_ALLOW_SIGN_CONVERSION,
+// in which case they are sign extended and the operation wraps modulo 2^256 like any other
+template <typename SignedInteger>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t sign_converted_u256(const SignedInteger value) noexcept
+{
+    #ifndef BOOST_INT128_ALLOW_SIGN_CONVERSION
+    static_assert(is_unsigned_integer_v<SignedInteger>, "Sign Conversion Error");
+    #endif
+
+    return static_cast<uint256_t>(value);
+}
+
+// Comparisons against builtin signed operands are only accepted under BOOST_INT128_ALLOW_SIGN_COMPARE,
+// where a negative value compares less than every uint256_t
+template <typename SignedInteger>
+BOOST_INT128_HOST_DEVICE constexpr bool is_negative_u256_operand(const SignedInteger value) noexcept
+{
+    #ifndef BOOST_INT128_ALLOW_SIGN_COMPARE
+    static_assert(is_unsigned_integer_v<SignedInteger>, "Sign Compare Error");
+    #endif
+
+    return value < 0;
+}
+
+} // namespace detail
+
+//=====================================
+// Absolute Value function
+//=====================================
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t abs(const uint256_t value) noexcept
+{
+    return value;
+}
+
+//=====================================
+// Float Conversion Operators
+//=====================================
+
+// Same approach as uint128_t, applying the 2^64 offset twice to place the high half
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t::operator float() const noexcept
+{
+    return static_cast<float>(high) * detail::offset_value_v<float> * detail::offset_value_v<float> + static_cast<float>(low);
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t::operator double() const noexcept
+{
+    return static_cast<double>(high) * detail::offset_value_v<double> * detail::offset_value_v<double> + static_cast<double>(low);
+}
+
+#if !(defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA))
+
+constexpr uint256_t::operator long double() const noexcept
+{
+    return static_cast<long double>(high) * detail::offset_value_v<long double> * detail::offset_value_v<long double> + static_cast<long double>(low);
+}
+
+#endif // __NVCC__
+
+//=====================================
+// Unary Operators
+//=====================================
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t operator+(const uint256_t value) noexcept
+{
+    return value;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t operator-(const uint256_t value) noexcept
+{
+    return {~value.high + static_cast<std::uint64_t>(value.low == 0U), ~value.low + 1U};
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t operator~(const uint256_t value) noexcept
+{
+    return {~value.high, ~value.low};
+}
+
+//=====================================
+// Comparison Operators
+//=====================================
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator==(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    return lhs.low == rhs.low && lhs.high == rhs.high;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator!=(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator<(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    return lhs.high == rhs.high ? lhs.low < rhs.low : lhs.high < rhs.high;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator<=(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    return !(rhs < lhs);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator>(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    return rhs < lhs;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool operator>=(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    return !(lhs < rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator==(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return !detail::is_negative_u256_operand(rhs) && lhs == static_cast<uint256_t>(rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator==(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return rhs == lhs;
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator!=(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator!=(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return !(rhs == lhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator<(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return !detail::is_negative_u256_operand(rhs) && lhs < static_cast<uint256_t>(rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator<(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return detail::is_negative_u256_operand(lhs) || static_cast<uint256_t>(lhs) < rhs;
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator<=(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return !(rhs < lhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator<=(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return !(rhs < lhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator>(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return rhs < lhs;
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator>(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return rhs < lhs;
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator>=(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return !(lhs < rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr bool operator>=(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return !(lhs < rhs);
+}
+
+#ifdef BOOST_INT128_HAS_SPACESHIP_OPERATOR
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr std::strong_ordering operator<=>(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    if (lhs < rhs)
+    {
+        return std::strong_ordering::less;
+    }
+    else if (lhs == rhs)
+    {
+        return std::strong_ordering::equivalent;
+    }
+    else
+    {
+        return std::strong_ordering::greater;
+    }
+}
+
+#endif // BOOST_INT128_HAS_SPACESHIP_OPERATOR
+
+//=====================================
+// Bitwise Operators
+//=====================================
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t operator|(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    return {lhs.high | rhs.high, lhs.low | rhs.low};
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t operator&(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    return {lhs.high & rhs.high, lhs.low & rhs.low};
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t operator^(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    return {lhs.high ^ rhs.high, lhs.low ^ rhs.low};
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator|(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return lhs | detail::sign_converted_u256(rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator|(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return detail::sign_converted_u256(lhs) | rhs;
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator&(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return lhs & detail::sign_converted_u256(rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator&(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return detail::sign_converted_u256(lhs) & rhs;
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator^(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return lhs ^ detail::sign_converted_u256(rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator^(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return detail::sign_converted_u256(lhs) ^ rhs;
+}
+
+//=====================================
+// Shift Operators
+//=====================================
+
+namespace detail {
+
+template <typename Integer>
+BOOST_INT128_HOST_DEVICE constexpr bool is_out_of_range_u256_shift(const Integer rhs) noexcept
+{
+    BOOST_INT128_IF_CONSTEXPR (std::numeric_limits<Integer>::is_signed)
+    {
+        if (rhs < 0)
+        {
+            return true;
+        }
+    }
+
+    return static_cast<evaluation_type_t<Integer>>(rhs) >= 256U;
+}
+
+} // namespace detail
+
+// Shifting by a negative amount, or by the width of the type or more gives zero, as with uint128_t
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator<<(const uint256_t lhs, const Integer rhs) noexcept
+{
+    if (detail::is_out_of_range_u256_shift(rhs))
+    {
+        return {0U, 0U};
+    }
+
+    const auto shift {static_cast<unsigned>(rhs)};
+
+    if (shift >= 128U)
+    {
+        return {lhs.low << (shift - 128U), 0U};
+    }
+
+    // The shift of the low half by 128 - 0 == 128 is defined to give zero
+    return {(lhs.high << shift) | (lhs.low >> (128U - shift)), lhs.low << shift};
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator>>(const uint256_t lhs, const Integer rhs) noexcept
+{
+    if (detail::is_out_of_range_u256_shift(rhs))
+    {
+        return {0U, 0U};
+    }
+
+    const auto shift {static_cast<unsigned>(rhs)};
+
+    if (shift >= 128U)
+    {
+        return {0U, lhs.high >> (shift - 128U)};
+    }
+
+    return {lhs.high >> shift, (lhs.low >> shift) | (lhs.high << (128U - shift))};
+}
+
+//=====================================
+// Addition and Subtraction Operators
+//=====================================
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t operator+(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    const auto low {lhs.low + rhs.low};
+    return {lhs.high + rhs.high + static_cast<std::uint64_t>(low < lhs.low), low};
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t operator-(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    return {lhs.high - rhs.high - static_cast<std::uint64_t>(lhs.low < rhs.low), lhs.low - rhs.low};
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator+(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return lhs + detail::sign_converted_u256(rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator+(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return detail::sign_converted_u256(lhs) + rhs;
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator-(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return lhs - detail::sign_converted_u256(rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator-(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return detail::sign_converted_u256(lhs) - rhs;
+}
+
+//=====================================
+// Multiplication Operators
+//=====================================
+
+// The full product of the low halves plus the low halves of the two cross products.
+// The product of the high halves lies entirely above bit 256
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t operator*(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    std::uint64_t words[4] {};
+    detail::umul128_words(lhs.low.high, lhs.low.low, rhs.low.high, rhs.low.low, words);
+
+    const uint128_t low_high {words[3], words[2]};
+
+    return {low_high + lhs.low * rhs.high + lhs.high * rhs.low, uint128_t{words[1], words[0]}};
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator*(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return lhs * detail::sign_converted_u256(rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator*(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return detail::sign_converted_u256(lhs) * rhs;
+}
+
+//=====================================
+// Division and Modulo Operators
+//=====================================
+
+namespace detail {
+
+// Divides lhs by the non-zero divisor, returning the quotient and writing the remainder
+//
+// A divisor of at most 128 bits is handled directly by the 256 by 128-bit word division.
+// Otherwise the quotient fits in 128 bits, and is estimated from the top 128 bits of the normalized divisor
+// to within one of the true value, which a single multiply and compare then corrects.
+//
+// See: Henry S. Warren, Hacker's Delight 2nd Edition, Section 9-5
+BOOST_INT128_HOST_DEVICE constexpr uint256_t div_mod_u256(const uint256_t lhs, const uint256_t rhs, uint256_t& remainder) noexcept
+{
+    BOOST_INT128_ASSUME(rhs != 0U); // LCOV_EXCL_LINE
+
+    if (rhs.high == 0U)
+    {
+        if (lhs.high == 0U)
+        {
+            const auto quotient {lhs.low / rhs.low};
+            remainder = lhs.low - quotient * rhs.low;
+            return quotient;
+        }
+
+        const std::uint64_t u[4] {lhs.low.low, lhs.low.high, lhs.high.low, lhs.high.high};
+        std::uint64_t q[4] {};
+        std::uint64_t r_high {};
+        std::uint64_t r_low {};
+        div_wide_words(u, rhs.low.high, rhs.low.low, q, r_high, r_low);
+
+        remainder = uint128_t{r_high, r_low};
+        return {uint128_t{q[3], q[2]}, uint128_t{q[1], q[0]}};
+    }
+
+    if (lhs < rhs)
+    {
+        remainder = lhs;
+        return {0U, 0U};
+    }
+
+    const auto shift {rhs.high.high != 0U ? countl_zero(rhs.high.high) : 64 + countl_zero(rhs.high.low)};
+    const auto normalized_divisor {(rhs << shift).high};
+
+    // Halving the dividend keeps its top half below the normalized divisor, so the quotient fits in 128 bits
+    const auto halved {lhs >> 1U};
+    const std::uint64_t u[4] {halved.low.low, halved.low.high, halved.high.low, halved.high.high};
+    std::uint64_t q[4] {};
+    std::uint64_t r_high {};
+    std::uint64_t r_low {};
+    div_wide_words(u, normalized_divisor.high, normalized_divisor.low, q, r_high, r_low);
+
+    // Undo the normalization and the halving. The intermediate needs all 256 bits
+    auto quotient {((uint256_t{uint128_t{q[1], q[0]}} << shift) >> 127U).low};
+    if (quotient != 0U)
+    {
+        --quotient;
+    }
+
+    auto rem {lhs - uint256_t{quotient} * rhs};
+    if (rem >= rhs)
+    {
+        ++quotient;
+        rem -= rhs;
+    }
+
+    remainder = rem;
+    return quotient;
+}
+
+} // namespace detail
+
+// Division by zero gives zero, as with uint128_t
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t operator/(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(rhs == 0U))
+    {
+        return {0U, 0U};
+    }
+
+    uint256_t remainder {};
+    return detail::div_mod_u256(lhs, rhs, remainder);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint256_t operator%(const uint256_t lhs, const uint256_t rhs) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(rhs == 0U))
+    {
+        return {0U, 0U};
+    }
+
+    uint256_t remainder {};
+    static_cast<void>(detail::div_mod_u256(lhs, rhs, remainder));
+    return remainder;
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator/(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return lhs / detail::sign_converted_u256(rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator/(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return detail::sign_converted_u256(lhs) / rhs;
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator%(const uint256_t lhs, const SignedInteger rhs) noexcept
+{
+    return lhs % detail::sign_converted_u256(rhs);
+}
+
+BOOST_INT128_EXPORT template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t operator%(const SignedInteger lhs, const uint256_t rhs) noexcept
+{
+    return detail::sign_converted_u256(lhs) % rhs;
+}
+
+//=====================================
+// Compound Operators
+//=====================================
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator|=(const Integer rhs) noexcept
+{
+    *this = *this | rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator|=(const uint256_t rhs) noexcept
+{
+    *this = *this | rhs;
+    return *this;
+}
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator&=(const Integer rhs) noexcept
+{
+    *this = *this & rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator&=(const uint256_t rhs) noexcept
+{
+    *this = *this & rhs;
+    return *this;
+}
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator^=(const Integer rhs) noexcept
+{
+    *this = *this ^ rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator^=(const uint256_t rhs) noexcept
+{
+    *this = *this ^ rhs;
+    return *this;
+}
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator<<=(const Integer rhs) noexcept
+{
+    *this = *this << rhs;
+    return *this;
+}
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator>>=(const Integer rhs) noexcept
+{
+    *this = *this >> rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator++() noexcept
+{
+    ++low;
+    if (low == 0U)
+    {
+        ++high;
+    }
+
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t uint256_t::operator++(int) noexcept
+{
+    const auto temp {*this};
+    ++(*this);
+    return temp;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator--() noexcept
+{
+    if (low == 0U)
+    {
+        --high;
+    }
+    --low;
+
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t uint256_t::operator--(int) noexcept
+{
+    const auto temp {*this};
+    --(*this);
+    return temp;
+}
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator+=(const Integer rhs) noexcept
+{
+    *this = *this + rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator+=(const uint256_t rhs) noexcept
+{
+    *this = *this + rhs;
+    return *this;
+}
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator-=(const Integer rhs) noexcept
+{
+    *this = *this - rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator-=(const uint256_t rhs) noexcept
+{
+    *this = *this - rhs;
+    return *this;
+}
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator*=(const Integer rhs) noexcept
+{
+    *this = *this * rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator*=(const uint256_t rhs) noexcept
+{
+    *this = *this * rhs;
+    return *this;
+}
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator/=(const Integer rhs) noexcept
+{
+    *this = *this / rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator/=(const uint256_t rhs) noexcept
+{
+    *this = *this / rhs;
+    return *this;
+}
+
+template <BOOST_INT128_INTEGER_CONCEPT>
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator%=(const Integer rhs) noexcept
+{
+    *this = *this % rhs;
+    return *this;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t& uint256_t::operator%=(const uint256_t rhs) noexcept
+{
+    *this = *this % rhs;
+    return *this;
+}
+
+namespace detail {
+
+template <bool>
+class numeric_limits_impl_u256
+{
+public:
+
+    // Member constants
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = false;
+    static constexpr bool is_integer = true;
+    static constexpr bool is_exact = true;
+    static constexpr bool has_infinity = false;
+    static constexpr bool has_quiet_NaN = false;
+    static constexpr bool has_signaling_NaN = false;
+
+    // C++23 deprecated the following two members
+    #if defined(__GNUC__) && __cplusplus > 202002L
+    #  pragma GCC diagnostic push
+    #  pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+    #elif defined(_MSC_VER)
+    #  pragma warning(push)
+    #  pragma warning(disable:4996)
+    #endif
+
+    static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+    static constexpr bool has_denorm_loss = false;
+
+    #if defined(__GNUC__) && __cplusplus > 202002L
+    #  pragma GCC diagnostic pop
+    #elif defined(_MSC_VER)
+    #  pragma warning(pop)
+    #endif
+
+    static constexpr std::float_round_style round_style = std::round_toward_zero;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = true;
+    static constexpr int digits = 256;
+    static constexpr int digits10 = 77;
+    static constexpr int max_digits10 = 0;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = 0;
+    static constexpr int min_exponent10 = 0;
+    static constexpr int max_exponent = 0;
+    static constexpr int max_exponent10 = 0;
+    static constexpr bool traps = std::numeric_limits<std::uint64_t>::traps;
+    static constexpr bool tinyness_before = false;
+
+    // Member functions
+    BOOST_INT128_HOST_DEVICE static constexpr auto (min)        () -> boost::int128::uint256_t { return {0U, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto lowest       () -> boost::int128::uint256_t { return {0U, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto (max)        () -> boost::int128::uint256_t { return {uint128_t{UINT64_MAX, UINT64_MAX}, uint128_t{UINT64_MAX, UINT64_MAX}}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto epsilon      () -> boost::int128::uint256_t { return {0U, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto round_error  () -> boost::int128::uint256_t { return {0U, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto infinity     () -> boost::int128::uint256_t { return {0U, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto quiet_NaN    () -> boost::int128::uint256_t { return {0U, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto signaling_NaN() -> boost::int128::uint256_t { return {0U, 0U}; }
+    BOOST_INT128_HOST_DEVICE static constexpr auto denorm_min   () -> boost::int128::uint256_t { return {0U, 0U}; }
+};
+
+#if !defined(__cpp_inline_variables) || __cpp_inline_variables < 201606L
+
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::is_specialized;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::is_signed;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::is_integer;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::is_exact;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::has_infinity;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::has_quiet_NaN;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::has_signaling_NaN;
+
+// These members were deprecated in C++23
+#if ((!defined(_MSC_VER) && (__cplusplus <= 202002L)) || (defined(_MSC_VER) && (_MSVC_LANG <= 202002L)))
+template <bool b> constexpr std::float_denorm_style numeric_limits_impl_u256<b>::has_denorm;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::has_denorm_loss;
+#endif
+
+template <bool b> constexpr std::float_round_style numeric_limits_impl_u256<b>::round_style;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::is_iec559;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::is_bounded;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::is_modulo;
+template <bool b> constexpr int numeric_limits_impl_u256<b>::digits;
+template <bool b> constexpr int numeric_limits_impl_u256<b>::digits10;
+template <bool b> constexpr int numeric_limits_impl_u256<b>::max_digits10;
+template <bool b> constexpr int numeric_limits_impl_u256<b>::radix;
+template <bool b> constexpr int numeric_limits_impl_u256<b>::min_exponent;
+template <bool b> constexpr int numeric_limits_impl_u256<b>::min_exponent10;
+template <bool b> constexpr int numeric_limits_impl_u256<b>::max_exponent;
+template <bool b> constexpr int numeric_limits_impl_u256<b>::max_exponent10;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::traps;
+template <bool b> constexpr bool numeric_limits_impl_u256<b>::tinyness_before;
+
+#endif // !defined(__cpp_inline_variables) || __cpp_inline_variables < 201606L
+
+} // namespace detail
+
+} // namespace int128
+} // namespace boost
+
+namespace std {
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wmismatched-tags"
+#endif
+
+template <>
+class numeric_limits<boost::int128::uint256_t> :
+    public boost::int128::detail::numeric_limits_impl_u256<true> {};
+
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+} // namespace std
+
+#endif // BOOST_INT128_DETAIL_UINT256_IMP_HPP
@@ -0,0 +1,598 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_DIVIDER_HPP
+#define BOOST_INT128_DIVIDER_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/bit.hpp>
+#include <boost/int128/cstdlib.hpp>
+#include <boost/int128/detail/config.hpp>
+#include <boost/int128/detail/common_mul.hpp>
+#include <boost/int128/detail/common_div.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstdint>
+#include <cstddef>
+
+#if __has_include(<span>) && ((!defined(_MSC_VER) && __cplusplus >= 202002L) || (defined(_MSC_VER) && _MSVC_LANG >= 202002L))
+#  include <span>
+#endif
+
+#endif
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+#  define BOOST_INT128_HAS_SPAN
+#endif
+
+namespace boost {
+namespace int128 {
+
+// Divides many dividends by the same divisor.
+// The divisor is normalized and its reciprocal is computed once on construction,
+// after which every division is only multiplications, shifts and additions.
+BOOST_INT128_EXPORT class uint128_divider
+{
+private:
+
+    enum class divisor_kind : std::uint8_t
+    {
+        zero,
+        power_of_two,
+        one_word,
+        two_word
+    };
+
+    uint128_t divisor_ {};
+    std::uint64_t normalized_ {};
+    std::uint64_t reciprocal_ {};
+    int shift_ {};
+    divisor_kind kind_ {divisor_kind::zero};
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t one_word_div(const uint128_t n, std::uint64_t& remainder) const noexcept;
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t two_word_div(const uint128_t n, uint128_t& remainder) const noexcept;
+
+    template <divisor_kind kind>
+    BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr u128div_t divmod_as(uint128_t n) const noexcept;
+
+    // Calls store(i, divmod(load(i))) for every i in [0, size) with the dispatch on the kind of divisor
+    // hoisted out of the loop, so the loop body is straight line code the compiler can unroll and interleave
+    template <typename Load, typename Store>
+    BOOST_INT128_HOST_DEVICE constexpr void for_each_n(std::size_t size, Load load, Store store) const;
+
+    friend class int128_divider;
+
+public:
+
+    constexpr uint128_divider() noexcept = default;
+
+    BOOST_INT128_HOST_DEVICE explicit constexpr uint128_divider(uint128_t divisor) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t divisor() const noexcept { return divisor_; }
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t quotient(uint128_t n) const noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t remainder(uint128_t n) const noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr u128div_t divmod(uint128_t n) const noexcept;
+
+    #ifdef BOOST_INT128_HAS_SPAN
+
+    // Batched forms: out[i] = in[i] / divisor and so on. The outputs must be at least as long as the input
+    void quotient(std::span<const uint128_t> in, std::span<uint128_t> out) const noexcept;
+
+    void remainder(std::span<const uint128_t> in, std::span<uint128_t> out) const noexcept;
+
+    void divmod(std::span<const uint128_t> in, std::span<uint128_t> quotients, std::span<uint128_t> remainders) const noexcept;
+
+    #endif // BOOST_INT128_HAS_SPAN
+};
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_divider::uint128_divider(const uint128_t divisor) noexcept : divisor_ {divisor}
+{
+    if (divisor == 0U)
+    {
+        kind_ = divisor_kind::zero;
+    }
+    else if (has_single_bit(divisor))
+    {
+        kind_ = divisor_kind::power_of_two;
+        shift_ = countr_zero(divisor);
+    }
+    else if (divisor.high == 0U)
+    {
+        kind_ = divisor_kind::one_word;
+        shift_ = detail::countl_zero(divisor.low);
+        normalized_ = divisor.low << shift_;
+        reciprocal_ = detail::reciprocal_2by1(normalized_);
+    }
+    else
+    {
+        // Only the most significant word of the normalized divisor is needed,
+        // the estimate it produces is off by at most one and fixed in two_word_div
+        kind_ = divisor_kind::two_word;
+        shift_ = detail::countl_zero(divisor.high);
+        normalized_ = (divisor.high << shift_) | ((divisor.low >> 1U) >> (63 - shift_));
+        reciprocal_ = detail::reciprocal_2by1(normalized_);
+    }
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t uint128_divider::one_word_div(const uint128_t n, std::uint64_t& remainder) const noexcept
+{
+    uint128_t q {};
+    remainder = detail::one_word_div_preinv(n.high, n.low, normalized_, reciprocal_, shift_, q.high, q.low);
+    return q;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t uint128_divider::two_word_div(const uint128_t n, uint128_t& remainder) const noexcept
+{
+    const auto q {detail::two_word_div_preinv(n.high, n.low, divisor_.high, divisor_.low, normalized_, reciprocal_, shift_, remainder.high, remainder.low)};
+    return uint128_t{0U, q};
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t uint128_divider::quotient(const uint128_t n) const noexcept
+{
+    switch (kind_)
+    {
+        case divisor_kind::power_of_two:
+            return n >> shift_;
+        case divisor_kind::one_word:
+        {
+            std::uint64_t r {};
+            return one_word_div(n, r);
+        }
+        case divisor_kind::two_word:
+        {
+            uint128_t r {};
+            return two_word_div(n, r);
+        }
+        default:
+            return {0, 0};
+    }
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t uint128_divider::remainder(const uint128_t n) const noexcept
+{
+    switch (kind_)
+    {
+        case divisor_kind::power_of_two:
+            return n & (divisor_ - 1U);
+        case divisor_kind::one_word:
+        {
+            std::uint64_t r {};
+            one_word_div(n, r);
+            return uint128_t{0U, r};
+        }
+        case divisor_kind::two_word:
+        {
+            uint128_t r {};
+            two_word_div(n, r);
+            return r;
+        }
+        default:
+            return {0, 0};
+    }
+}
+
+BOOST_INT128_HOST_DEVICE constexpr u128div_t uint128_divider::divmod(const uint128_t n) const noexcept
+{
+    switch (kind_)
+    {
+        case divisor_kind::power_of_two:
+            return u128div_t{n >> shift_, n & (divisor_ - 1U)};
+        case divisor_kind::one_word:
+        {
+            std::uint64_t r {};
+            const auto q {one_word_div(n, r)};
+            return u128div_t{q, uint128_t{0U, r}};
+        }
+        case divisor_kind::two_word:
+        {
+            u128div_t res {};
+            res.quot = two_word_div(n, res.rem);
+            return res;
+        }
+        default:
+            return u128div_t{0U, 0U};
+    }
+}
+
+#if defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4127) // Pre c++17 the if constexpr branches will hit this
+#endif
+
+template <uint128_divider::divisor_kind kind>
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr u128div_t uint128_divider::divmod_as(const uint128_t n) const noexcept
+{
+    BOOST_INT128_IF_CONSTEXPR (kind == divisor_kind::power_of_two)
+    {
+        return u128div_t{n >> shift_, n & (divisor_ - 1U)};
+    }
+    else BOOST_INT128_IF_CONSTEXPR (kind == divisor_kind::one_word)
+    {
+        std::uint64_t r {};
+        const auto q {one_word_div(n, r)};
+        return u128div_t{q, uint128_t{0U, r}};
+    }
+    else BOOST_INT128_IF_CONSTEXPR (kind == divisor_kind::two_word)
+    {
+        u128div_t res {};
+        res.quot = two_word_div(n, res.rem);
+        return res;
+    }
+    else
+    {
+        return u128div_t{0U, 0U};
+    }
+}
+
+#if defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+template <typename Load, typename Store>
+BOOST_INT128_HOST_DEVICE constexpr void uint128_divider::for_each_n(const std::size_t size, Load load, Store store) const
+{
+    switch (kind_)
+    {
+        case divisor_kind::power_of_two:
+            for (std::size_t i {}; i < size; ++i)
+            {
+                store(i, divmod_as<divisor_kind::power_of_two>(load(i)));
+            }
+            break;
+        case divisor_kind::one_word:
+            for (std::size_t i {}; i < size; ++i)
+            {
+                store(i, divmod_as<divisor_kind::one_word>(load(i)));
+            }
+            break;
+        case divisor_kind::two_word:
+            for (std::size_t i {}; i < size; ++i)
+            {
+                store(i, divmod_as<divisor_kind::two_word>(load(i)));
+            }
+            break;
+        default:
+            for (std::size_t i {}; i < size; ++i)
+            {
+                store(i, divmod_as<divisor_kind::zero>(load(i)));
+            }
+            break;
+    }
+}
+
+#ifdef BOOST_INT128_HAS_SPAN
+
+inline void uint128_divider::quotient(const std::span<const uint128_t> in, const std::span<uint128_t> out) const noexcept
+{
+    BOOST_INT128_ASSERT_MSG(out.size() >= in.size(), "The output must be at least as long as the input");
+
+    for_each_n(in.size(), [in](const std::size_t i) { return in[i]; },
+                          [out](const std::size_t i, const u128div_t res) { out[i] = res.quot; });
+}
+
+inline void uint128_divider::remainder(const std::span<const uint128_t> in, const std::span<uint128_t> out) const noexcept
+{
+    BOOST_INT128_ASSERT_MSG(out.size() >= in.size(), "The output must be at least as long as the input");
+
+    for_each_n(in.size(), [in](const std::size_t i) { return in[i]; },
+                          [out](const std::size_t i, const u128div_t res) { out[i] = res.rem; });
+}
+
+inline void uint128_divider::divmod(const std::span<const uint128_t> in, const std::span<uint128_t> quotients, const std::span<uint128_t> remainders) const noexcept
+{
+    BOOST_INT128_ASSERT_MSG(quotients.size() >= in.size() && remainders.size() >= in.size(), "The outputs must be at least as long as the input");
+
+    for_each_n(in.size(), [in](const std::size_t i) { return in[i]; },
+                          [quotients, remainders](const std::size_t i, const u128div_t res)
+                          {
+                              quotients[i] = res.quot;
+                              remainders[i] = res.rem;
+                          });
+}
+
+#endif // BOOST_INT128_HAS_SPAN
+
+// Signed division truncates towards zero, and the remainder takes the sign of the dividend,
+// which matches the behavior of the int128_t operators
+BOOST_INT128_EXPORT class int128_divider
+{
+private:
+
+    uint128_divider abs_divisor_ {};
+    int128_t divisor_ {};
+
+public:
+
+    constexpr int128_divider() noexcept = default;
+
+    BOOST_INT128_HOST_DEVICE explicit constexpr int128_divider(const int128_t divisor) noexcept :
+        abs_divisor_ {static_cast<uint128_t>(divisor.high < 0 ? -divisor : divisor)}, divisor_ {divisor} {}
+
+    BOOST_INT128_HOST_DEVICE constexpr int128_t divisor() const noexcept { return divisor_; }
+
+    BOOST_INT128_HOST_DEVICE constexpr int128_t quotient(int128_t n) const noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr int128_t remainder(int128_t n) const noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr i128div_t divmod(int128_t n) const noexcept;
+
+    #ifdef BOOST_INT128_HAS_SPAN
+
+    void quotient(std::span<const int128_t> in, std::span<int128_t> out) const noexcept;
+
+    void remainder(std::span<const int128_t> in, std::span<int128_t> out) const noexcept;
+
+    void divmod(std::span<const int128_t> in, std::span<int128_t> quotients, std::span<int128_t> remainders) const noexcept;
+
+    #endif // BOOST_INT128_HAS_SPAN
+};
+
+namespace detail {
+
+// Applies the sign held in mask (all zeros or all ones) to value without branching
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr int128_t apply_sign_mask(const uint128_t value, const uint128_t mask) noexcept
+{
+    return static_cast<int128_t>((value ^ mask) - mask);
+}
+
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr uint128_t sign_mask(const int128_t value) noexcept
+{
+    const auto mask {static_cast<std::uint64_t>(value.high >> 63)};
+    return uint128_t{mask, mask};
+}
+
+} // namespace detail
+
+BOOST_INT128_HOST_DEVICE constexpr int128_t int128_divider::quotient(const int128_t n) const noexcept
+{
+    const auto n_mask {detail::sign_mask(n)};
+    const auto q_mask {n_mask ^ detail::sign_mask(divisor_)};
+    const auto abs_n {(static_cast<uint128_t>(n) ^ n_mask) - n_mask};
+
+    return detail::apply_sign_mask(abs_divisor_.quotient(abs_n), q_mask);
+}
+
+BOOST_INT128_HOST_DEVICE constexpr int128_t int128_divider::remainder(const int128_t n) const noexcept
+{
+    const auto n_mask {detail::sign_mask(n)};
+    const auto abs_n {(static_cast<uint128_t>(n) ^ n_mask) - n_mask};
+
+    return detail::apply_sign_mask(abs_divisor_.remainder(abs_n), n_mask);
+}
+
+BOOST_INT128_HOST_DEVICE constexpr i128div_t int128_divider::divmod(const int128_t n) const noexcept
+{
+    const auto n_mask {detail::sign_mask(n)};
+    const auto q_mask {n_mask ^ detail::sign_mask(divisor_)};
+    const auto abs_n {(static_cast<uint128_t>(n) ^ n_mask) - n_mask};
+
+    const auto res {abs_divisor_.divmod(abs_n)};
+
+    return i128div_t{detail::apply_sign_mask(res.quot, q_mask), detail::apply_sign_mask(res.rem, n_mask)};
+}
+
+#ifdef BOOST_INT128_HAS_SPAN
+
+// The unsigned loop runs on the magnitudes, and the signs are applied with masks on the way in and out
+
+inline void int128_divider::quotient(const std::span<const int128_t> in, const std::span<int128_t> out) const noexcept
+{
+    BOOST_INT128_ASSERT_MSG(out.size() >= in.size(), "The output must be at least as long as the input");
+
+    const auto divisor_mask {detail::sign_mask(divisor_)};
+
+    abs_divisor_.for_each_n(in.size(),
+        [in](const std::size_t i)
+        {
+            const auto mask {detail::sign_mask(in[i])};
+            return (static_cast<uint128_t>(in[i]) ^ mask) - mask;
+        },
+        [in, out, divisor_mask](const std::size_t i, const u128div_t res)
+        {
+            out[i] = detail::apply_sign_mask(res.quot, detail::sign_mask(in[i]) ^ divisor_mask);
+        });
+}
+
+inline void int128_divider::remainder(const std::span<const int128_t> in, const std::span<int128_t> out) const noexcept
+{
+    BOOST_INT128_ASSERT_MSG(out.size() >= in.size(), "The output must be at least as long as the input");
+
+    abs_divisor_.for_each_n(in.size(),
+        [in](const std::size_t i)
+        {
+            const auto mask {detail::sign_mask(in[i])};
+            return (static_cast<uint128_t>(in[i]) ^ mask) - mask;
+        },
+        [in, out](const std::size_t i, const u128div_t res)
+        {
+            out[i] = detail::apply_sign_mask(res.rem, detail::sign_mask(in[i]));
+        });
+}
+
+inline void int128_divider::divmod(const std::span<const int128_t> in, const std::span<int128_t> quotients, const std::span<int128_t> remainders) const noexcept
+{
+    BOOST_INT128_ASSERT_MSG(quotients.size() >= in.size() && remainders.size() >= in.size(), "The outputs must be at least as long as the input");
+
+    const auto divisor_mask {detail::sign_mask(divisor_)};
+
+    abs_divisor_.for_each_n(in.size(),
+        [in](const std::size_t i)
+        {
+            const auto mask {detail::sign_mask(in[i])};
+            return (static_cast<uint128_t>(in[i]) ^ mask) - mask;
+        },
+        [in, quotients, remainders, divisor_mask](const std::size_t i, const u128div_t res)
+        {
+            const auto mask {detail::sign_mask(in[i])};
+            quotients[i] = detail::apply_sign_mask(res.quot, mask ^ divisor_mask);
+            remainders[i] = detail::apply_sign_mask(res.rem, mask);
+        });
+}
+
+// Divides a whole array by one divisor, with the reciprocal of the divisor computed once.
+// The outputs must be at least as long as the input, and may alias it
+
+BOOST_INT128_EXPORT inline void divide(const std::span<const uint128_t> in, const uint128_t divisor, const std::span<uint128_t> out) noexcept
+{
+    uint128_divider{divisor}.quotient(in, out);
+}
+
+BOOST_INT128_EXPORT inline void remainder(const std::span<const uint128_t> in, const uint128_t divisor, const std::span<uint128_t> out) noexcept
+{
+    uint128_divider{divisor}.remainder(in, out);
+}
+
+BOOST_INT128_EXPORT inline void divmod(const std::span<const uint128_t> in, const uint128_t divisor,
+                                       const std::span<uint128_t> quotients, const std::span<uint128_t> remainders) noexcept
+{
+    uint128_divider{divisor}.divmod(in, quotients, remainders);
+}
+
+BOOST_INT128_EXPORT inline void divide(const std::span<const int128_t> in, const int128_t divisor, const std::span<int128_t> out) noexcept
+{
+    int128_divider{divisor}.quotient(in, out);
+}
+
+BOOST_INT128_EXPORT inline void remainder(const std::span<const int128_t> in, const int128_t divisor, const std::span<int128_t> out) noexcept
+{
+    int128_divider{divisor}.remainder(in, out);
+}
+
+BOOST_INT128_EXPORT inline void divmod(const std::span<const int128_t> in, const int128_t divisor,
+                                       const std::span<int128_t> quotients, const std::span<int128_t> remainders) noexcept
+{
+    int128_divider{divisor}.divmod(in, quotients, remainders);
+}
+
+#endif // BOOST_INT128_HAS_SPAN
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint128_t operator/(const uint128_t lhs, const uint128_divider& rhs) noexcept
+{
+    return rhs.quotient(lhs);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint128_t operator%(const uint128_t lhs, const uint128_divider& rhs) noexcept
+{
+    return rhs.remainder(lhs);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint128_t& operator/=(uint128_t& lhs, const uint128_divider& rhs) noexcept
+{
+    lhs = rhs.quotient(lhs);
+    return lhs;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr uint128_t& operator%=(uint128_t& lhs, const uint128_divider& rhs) noexcept
+{
+    lhs = rhs.remainder(lhs);
+    return lhs;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr u128div_t div(const uint128_t x, const uint128_divider& y) noexcept
+{
+    return y.divmod(x);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int128_t operator/(const int128_t lhs, const int128_divider& rhs) noexcept
+{
+    return rhs.quotient(lhs);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int128_t operator%(const int128_t lhs, const int128_divider& rhs) noexcept
+{
+    return rhs.remainder(lhs);
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int128_t& operator/=(int128_t& lhs, const int128_divider& rhs) noexcept
+{
+    lhs = rhs.quotient(lhs);
+    return lhs;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr int128_t& operator%=(int128_t& lhs, const int128_divider& rhs) noexcept
+{
+    lhs = rhs.remainder(lhs);
+    return lhs;
+}
+
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr i128div_t div(const int128_t x, const int128_divider& y) noexcept
+{
+    return y.divmod(x);
+}
+
+// Division by a compile time constant: div_by<high, low>(x) computes x / uint128_t{high, low}
+// with a precomputed multiplier, shift and correction instead of a run time division
+
+BOOST_INT128_EXPORT template <std::uint64_t divisor_high, std::uint64_t divisor_low>
+BOOST_INT128_HOST_DEVICE constexpr uint128_t div_by(const uint128_t x) noexcept
+{
+    return detail::div_by_constant<divisor_high, divisor_low>(x);
+}
+
+BOOST_INT128_EXPORT template <std::uint64_t divisor_high, std::uint64_t divisor_low>
+BOOST_INT128_HOST_DEVICE constexpr uint128_t mod_by(const uint128_t x) noexcept
+{
+    return detail::mod_by_constant<divisor_high, divisor_low>(x);
+}
+
+BOOST_INT128_EXPORT template <std::uint64_t divisor_high, std::uint64_t divisor_low>
+BOOST_INT128_HOST_DEVICE constexpr int128_t div_by(const int128_t x) noexcept
+{
+    static_assert((divisor_high >> 63U) == 0U, "The divisor must be a positive int128_t");
+
+    const auto mask {detail::sign_mask(x)};
+    const auto abs_x {(static_cast<uint128_t>(x) ^ mask) - mask};
+
+    return detail::apply_sign_mask(detail::div_by_constant<divisor_high, divisor_low>(abs_x), mask);
+}
+
+BOOST_INT128_EXPORT template <std::uint64_t divisor_high, std::uint64_t divisor_low>
+BOOST_INT128_HOST_DEVICE constexpr int128_t mod_by(const int128_t x) noexcept
+{
+    static_assert((divisor_high >> 63U) == 0U, "The divisor must be a positive int128_t");
+
+    const auto mask {detail::sign_mask(x)};
+    const auto abs_x {(static_cast<uint128_t>(x) ^ mask) - mask};
+
+    return detail::apply_sign_mask(detail::mod_by_constant<divisor_high, divisor_low>(abs_x), mask);
+}
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+
+// With C++20 the divisor can be given directly, e.g. div_by<uint128_t{0, 10}>(x)
+
+BOOST_INT128_EXPORT template <uint128_t divisor>
+BOOST_INT128_HOST_DEVICE constexpr uint128_t div_by(const uint128_t x) noexcept
+{
+    return detail::div_by_constant<divisor.high, divisor.low>(x);
+}
+
+BOOST_INT128_EXPORT template <uint128_t divisor>
+BOOST_INT128_HOST_DEVICE constexpr uint128_t mod_by(const uint128_t x) noexcept
+{
+    return detail::mod_by_constant<divisor.high, divisor.low>(x);
+}
+
+BOOST_INT128_EXPORT template <uint128_t divisor>
+BOOST_INT128_HOST_DEVICE constexpr int128_t div_by(const int128_t x) noexcept
+{
+    return div_by<divisor.high, divisor.low>(x);
+}
+
+BOOST_INT128_EXPORT template <uint128_t divisor>
+BOOST_INT128_HOST_DEVICE constexpr int128_t mod_by(const int128_t x) noexcept
+{
+    return mod_by<divisor.high, divisor.low>(x);
+}
+
+#endif // C++20 class type non-type template parameters
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_DIVIDER_HPP
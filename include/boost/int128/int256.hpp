@@ -0,0 +1,33 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_INT256_HPP
+#define BOOST_INT128_INT256_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/detail/fwd.hpp>
+#include <boost/int128/detail/uint256_imp.hpp>
+#include <boost/int128/detail/int256_imp.hpp>
+
+namespace boost {
+namespace int128 {
+
+#if BOOST_INT128_ENDIAN_LITTLE_BYTE
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t::int256_t(const uint256_t& v) noexcept : low {v.low}, high {static_cast<int128_t>(v.high)} {}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t::uint256_t(const int256_t& v) noexcept : low {v.low}, high {static_cast<uint128_t>(v.high)} {}
+
+#else
+
+BOOST_INT128_HOST_DEVICE constexpr int256_t::int256_t(const uint256_t& v) noexcept : high {static_cast<int128_t>(v.high)}, low {v.low} {}
+
+BOOST_INT128_HOST_DEVICE constexpr uint256_t::uint256_t(const int256_t& v) noexcept : high {static_cast<uint128_t>(v.high)}, low {v.low} {}
+
+#endif // BOOST_INT128_ENDIAN_LITTLE_BYTE
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_INT256_HPP
@@ -6,6 +6,7 @@
 #define BOOST_INT128_IOSTREAM_HPP
 
 #include <boost/int128/int128.hpp>
+#include <boost/int128/int256.hpp>
 #include <boost/int128/detail/mini_from_chars.hpp>
 #include <boost/int128/detail/mini_to_chars.hpp>
 #include <boost/int128/detail/utilities.hpp>
@@ -28,24 +29,31 @@ namespace detail {
 template <typename T>
 struct streamable_overload
 {
-    static constexpr bool value = std::is_same<T, uint128_t>::value || std::is_same<T, int128_t>::value;
+    static constexpr bool value = std::is_same<T, uint128_t>::value || std::is_same<T, int128_t>::value ||
+                                  std::is_same<T, uint256_t>::value || std::is_same<T, int256_t>::value;
 };
 
 template <typename T>
 BOOST_INT128_INLINE_CONSTEXPR bool is_streamable_overload_v = streamable_overload<T>::value;
 
+// Large enough for the octal representation with its prefix and sign: 64 characters for the 128-bit types and 128 for the 256-bit types
+template <typename T>
+BOOST_INT128_INLINE_CONSTEXPR std::size_t stream_buffer_size_v = sizeof(T) * 4U;
+
 } // namespace detail
 
 BOOST_INT128_EXPORT template <typename charT, typename traits, typename LibIntegerType>
 auto operator>>(std::basic_istream<charT, traits>& is, LibIntegerType& v)
     -> std::enable_if_t<detail::is_streamable_overload_v<LibIntegerType>, std::basic_istream<charT, traits>&>
 {
-    charT t_buffer[64] {};
-    is >> std::ws >> std::setw(63) >> t_buffer;
+    constexpr auto buffer_size {detail::stream_buffer_size_v<LibIntegerType>};
+
+    charT t_buffer[buffer_size] {};
+    is >> std::ws >> std::setw(static_cast<int>(buffer_size - 1U)) >> t_buffer;
 
     const auto t_buffer_len {std::char_traits<charT>::length(t_buffer)};
 
-    char buffer[64] {};
+    char buffer[buffer_size] {};
     auto buffer_start {buffer};
 
     BOOST_INT128_IF_CONSTEXPR (!std::is_same<charT, char>::value)
@@ -103,7 +111,9 @@ BOOST_INT128_EXPORT template <typename charT, typename traits, typename LibInteg
 auto operator<<(std::basic_ostream<charT, traits>& os, const LibIntegerType& v)
     -> std::enable_if_t<detail::is_streamable_overload_v<LibIntegerType>, std::basic_ostream<charT, traits>&>
 {
-    char buffer[64U] {};
+    constexpr auto buffer_size {detail::stream_buffer_size_v<LibIntegerType>};
+
+    char buffer[buffer_size] {};
 
     const auto flags {os.flags()};
     int base {10};
@@ -136,7 +146,7 @@ auto operator<<(std::basic_ostream<charT, traits>& os, const LibIntegerType& v)
 
     BOOST_INT128_IF_CONSTEXPR (!std::is_same<charT, char>::value)
     {
-        charT t_buffer[64U] {};
+        charT t_buffer[buffer_size] {};
 
         auto t_first {t_buffer};
         while (*first != '\0')
@@ -0,0 +1,205 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_MONTGOMERY_HPP
+#define BOOST_INT128_MONTGOMERY_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/detail/config.hpp>
+#include <boost/int128/detail/common_mul.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstdint>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+namespace detail {
+
+// Inverse of an odd value modulo 2^64 by Newton's iteration x <- x * (2 - value * x), which doubles the number of correct bits.
+// (3 * value) ^ 2 is already correct to 5 bits, so four steps reach 64 bits
+//
+// See: Jeffrey Hurchalla, An Improved Integer Multiplicative Inverse (modulo 2^w), 2022
+BOOST_INT128_HOST_DEVICE constexpr std::uint64_t inverse_mod_2_64(const std::uint64_t value) noexcept
+{
+    auto x {(3U * value) ^ 2U};
+
+    for (int i {}; i < 4; ++i)
+    {
+        x *= 2U - value * x;
+    }
+
+    return x;
+}
+
+// Inverse of an odd value modulo 2^128. The single word inverse of the low word is correct to 64 bits,
+// so one 128-bit step finishes it
+BOOST_INT128_HOST_DEVICE constexpr uint128_t inverse_mod_2_128(const uint128_t value) noexcept
+{
+    uint128_t x {0U, inverse_mod_2_64(value.low)};
+    x *= 2U - value * x;
+
+    return x;
+}
+
+// (lhs + rhs) mod modulus for lhs, rhs < modulus, without losing the carry out of the top bit
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr uint128_t add_mod(const uint128_t lhs, const uint128_t rhs, const uint128_t modulus) noexcept
+{
+    const auto sum {lhs + rhs};
+    return (sum < lhs || sum >= modulus) ? sum - modulus : sum;
+}
+
+// (lhs - rhs) mod modulus for lhs, rhs < modulus
+BOOST_INT128_HOST_DEVICE BOOST_INT128_FORCE_INLINE constexpr uint128_t sub_mod(const uint128_t lhs, const uint128_t rhs, const uint128_t modulus) noexcept
+{
+    const auto diff {lhs - rhs};
+    return lhs < rhs ? diff + modulus : diff;
+}
+
+} // namespace detail
+
+// Modular arithmetic with a fixed odd modulus using Montgomery multiplication with R = 2^128.
+// Values are kept in Montgomery form (x * R mod m) between to_mont and from_mont,
+// so that every product is reduced with multiplications alone, and the full 256-bit product is never truncated.
+//
+// See: Peter L. Montgomery, Modular Multiplication Without Trial Division, Mathematics of Computation 44 (1985)
+BOOST_INT128_EXPORT class montgomery128
+{
+private:
+
+    uint128_t modulus_ {};
+    uint128_t neg_inverse_ {};  // -m^-1 mod 2^128
+    uint128_t one_ {};          // R mod m
+    uint128_t r_squared_ {};    // R^2 mod m
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t redc(const std::uint64_t (&t)[4]) const noexcept;
+
+public:
+
+    constexpr montgomery128() noexcept = default;
+
+    BOOST_INT128_HOST_DEVICE explicit constexpr montgomery128(uint128_t modulus) noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t modulus() const noexcept { return modulus_; }
+
+    // The representation of 1 in Montgomery form
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t one() const noexcept { return one_; }
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t to_mont(uint128_t x) const noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t from_mont(uint128_t x) const noexcept;
+
+    // The operations below take and return values in Montgomery form
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t mul(uint128_t lhs, uint128_t rhs) const noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t sqr(uint128_t x) const noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t pow(uint128_t base, uint128_t exponent) const noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t add(uint128_t lhs, uint128_t rhs) const noexcept;
+
+    BOOST_INT128_HOST_DEVICE constexpr uint128_t sub(uint128_t lhs, uint128_t rhs) const noexcept;
+};
+
+BOOST_INT128_HOST_DEVICE constexpr montgomery128::montgomery128(const uint128_t modulus) noexcept :
+    modulus_ {modulus}, neg_inverse_ {-detail::inverse_mod_2_128(modulus)}, one_ {(0U - modulus) % modulus}
+{
+    BOOST_INT128_ASSERT_MSG((modulus.low & 1U) == 1U && modulus > 1U, "The modulus must be odd and greater than 1");
+
+    // R^2 mod m by doubling R mod m another 128 times
+    r_squared_ = one_;
+    for (int i {}; i < 128; ++i)
+    {
+        r_squared_ = detail::add_mod(r_squared_, r_squared_, modulus_);
+    }
+}
+
+// Montgomery reduction of the 256-bit value t < m * R, returning t * R^-1 mod m
+BOOST_INT128_HOST_DEVICE constexpr uint128_t montgomery128::redc(const std::uint64_t (&t)[4]) const noexcept
+{
+    const uint128_t t_low {t[1], t[0]};
+    const uint128_t t_high {t[3], t[2]};
+
+    // u * m == -t_low mod R, so the low half of t + u * m is zero,
+    // and it carries out exactly when t_low is non-zero
+    const auto u {t_low * neg_inverse_};
+
+    std::uint64_t um[4] {};
+    detail::umul128_words(u.high, u.low, modulus_.high, modulus_.low, um);
+
+    const uint128_t um_high {um[3], um[2]};
+    const auto partial {t_high + um_high};
+    const auto result {partial + static_cast<std::uint64_t>(t_low != 0U)};
+
+    // The result is less than 2m, but it may have carried out of 128 bits
+    const auto overflow {partial < t_high || result < partial};
+
+    return (overflow || result >= modulus_) ? result - modulus_ : result;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t montgomery128::to_mont(const uint128_t x) const noexcept
+{
+    // x * R^2 < R * m for any x, so no reduction of x is required first
+    return mul(x, r_squared_);
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t montgomery128::from_mont(const uint128_t x) const noexcept
+{
+    const std::uint64_t t[4] {x.low, x.high, 0U, 0U};
+    return redc(t);
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t montgomery128::mul(const uint128_t lhs, const uint128_t rhs) const noexcept
+{
+    std::uint64_t t[4] {};
+    detail::umul128_words(lhs.high, lhs.low, rhs.high, rhs.low, t);
+    return redc(t);
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t montgomery128::sqr(const uint128_t x) const noexcept
+{
+    std::uint64_t t[4] {};
+    detail::usqr128_words(x.high, x.low, t);
+    return redc(t);
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t montgomery128::pow(uint128_t base, uint128_t exponent) const noexcept
+{
+    auto result {one_};
+
+    while (exponent != 0U)
+    {
+        if ((exponent.low & 1U) == 1U)
+        {
+            result = mul(result, base);
+        }
+
+        exponent >>= 1U;
+
+        if (exponent != 0U)
+        {
+            base = sqr(base);
+        }
+    }
+
+    return result;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t montgomery128::add(const uint128_t lhs, const uint128_t rhs) const noexcept
+{
+    return detail::add_mod(lhs, rhs, modulus_);
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t montgomery128::sub(const uint128_t lhs, const uint128_t rhs) const noexcept
+{
+    return detail::sub_mod(lhs, rhs, modulus_);
+}
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_MONTGOMERY_HPP
@@ -0,0 +1,518 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_PRIMES_HPP
+#define BOOST_INT128_PRIMES_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/bit.hpp>
+#include <boost/int128/numeric.hpp>
+#include <boost/int128/divider.hpp>
+#include <boost/int128/montgomery.hpp>
+#include <boost/int128/detail/config.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+namespace detail {
+
+// Holds what is needed to test x % prime == 0 for a 64-bit x with a single multiplication:
+// x is divisible exactly when x * prime^-1 mod 2^64 <= floor((2^64 - 1) / prime)
+//
+// See: Torbjorn Granlund and Peter L. Montgomery, Division by Invariant Integers using Multiplication, 1994, section 9
+struct small_prime
+{
+    std::uint64_t prime;
+    std::uint64_t inverse;
+    std::uint64_t limit;
+
+    BOOST_INT128_HOST_DEVICE constexpr small_prime(const std::uint64_t p) noexcept :
+        prime {p}, inverse {inverse_mod_2_64(p)}, limit {UINT64_MAX / p} {}
+
+    BOOST_INT128_HOST_DEVICE constexpr bool divides(const std::uint64_t x) const noexcept
+    {
+        return x * inverse <= limit;
+    }
+};
+
+#if !(defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA))
+
+// The odd primes below 151 split into groups whose products fit into a single word,
+// so one 128-bit reduction per group leaves only 64-bit divisibility tests
+BOOST_INT128_INLINE_CONSTEXPR small_prime small_primes[] = {
+    3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53,
+    59, 61, 67, 71, 73, 79, 83, 89, 97, 101,
+    103, 107, 109, 113, 127, 131, 137, 139, 149
+};
+
+BOOST_INT128_INLINE_CONSTEXPR std::size_t small_prime_group_end[] = {15, 25, 34};
+
+BOOST_INT128_INLINE_CONSTEXPR std::uint64_t small_prime_products[] = {
+    UINT64_C(16294579238595022365),
+    UINT64_C(7145393598349078859),
+    UINT64_C(6408001374760705163)
+};
+
+// Every composite below 151^2 has a factor in small_primes
+BOOST_INT128_INLINE_CONSTEXPR std::uint64_t small_prime_trial_limit {UINT64_C(22801)};
+
+#endif
+
+// Jacobi symbol (a / n) for odd n
+BOOST_INT128_HOST_DEVICE constexpr int jacobi(uint128_t a, uint128_t n) noexcept
+{
+    a %= n;
+    int result {1};
+
+    while (a != 0U)
+    {
+        while ((a.low & 1U) == 0U)
+        {
+            a >>= 1U;
+            const auto r {n.low & 7U};
+            if (r == 3U || r == 5U)
+            {
+                result = -result;
+            }
+        }
+
+        const auto temp {a};
+        a = n;
+        n = temp;
+
+        if ((a.low & 3U) == 3U && (n.low & 3U) == 3U)
+        {
+            result = -result;
+        }
+
+        a %= n;
+    }
+
+    return n == 1U ? result : 0;
+}
+
+BOOST_INT128_HOST_DEVICE constexpr bool is_perfect_square(const uint128_t n) noexcept
+{
+    const auto x {isqrt(n)};
+    return x * x == n;
+}
+
+// Strong probable prime test to base 2 for odd n > 2
+BOOST_INT128_HOST_DEVICE constexpr bool is_strong_probable_prime_base_2(const montgomery128& ctx) noexcept
+{
+    const auto n {ctx.modulus()};
+    const auto n_minus_one {n - 1U};
+    const auto s {countr_zero(n_minus_one)};
+    const auto d {n_minus_one >> s};
+
+    const auto one {ctx.one()};
+    const auto minus_one {n - one};
+
+    auto x {ctx.pow(ctx.add(one, one), d)};
+
+    if (x == one || x == minus_one)
+    {
+        return true;
+    }
+
+    for (int r {1}; r < s; ++r)
+    {
+        x = ctx.sqr(x);
+
+        if (x == minus_one)
+        {
+            return true;
+        }
+        if (x == one)
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+// (negative ? -value : value) mod n
+BOOST_INT128_HOST_DEVICE constexpr uint128_t signed_mod(const std::uint64_t value, const bool negative, const uint128_t n) noexcept
+{
+    const auto r {uint128_t{value} % n};
+    return negative && r != 0U ? n - r : r;
+}
+
+// Strong Lucas probable prime test with Selfridge's parameters (method A) for odd n that is not a perfect square
+//
+// See: Robert Baillie and Samuel S. Wagstaff Jr., Lucas Pseudoprimes, Mathematics of Computation 35 (1980)
+BOOST_INT128_HOST_DEVICE constexpr bool is_strong_lucas_probable_prime(const montgomery128& ctx) noexcept
+{
+    const auto n {ctx.modulus()};
+
+    // Find the first D in 5, -7, 9, -11, ... with (D / n) == -1, then P = 1 and Q = (1 - D) / 4
+    std::uint64_t abs_d {5};
+    bool negative_d {false};
+
+    for (int attempts {}; ; ++attempts)
+    {
+        const auto j {jacobi(signed_mod(abs_d, negative_d, n), n)};
+
+        if (j == -1)
+        {
+            break;
+        }
+        if (j == 0 && n != abs_d)
+        {
+            return false;
+        }
+
+        // (D / n) is never -1 for a square, so stop searching once that is ruled out
+        if (attempts == 8 && is_perfect_square(n))
+        {
+            return false;
+        }
+
+        abs_d += 2U;
+        negative_d = !negative_d;
+    }
+
+    // Q = (1 - D) / 4, which is negative for positive D
+    const auto abs_q {negative_d ? (abs_d + 1U) / 4U : (abs_d - 1U) / 4U};
+    const auto q_negative {!negative_d};
+
+    if (abs_q > 1U)
+    {
+        const auto g {gcd64((n % abs_q).low, abs_q)};
+        if (g != 1U && n != g)
+        {
+            return false;
+        }
+    }
+
+    const auto one {ctx.one()};
+    const auto d_mont {ctx.to_mont(signed_mod(abs_d, negative_d, n))};
+    const auto q_mont {ctx.to_mont(signed_mod(abs_q, q_negative, n))};
+
+    // n + 1 = d * 2^s with d odd. n is odd and not 2^128 - 1, which is divisible by 3
+    const auto n_plus_one {n + 1U};
+    const auto s {countr_zero(n_plus_one)};
+    const auto d {n_plus_one >> s};
+
+    // Binary ladder over the bits of d starting from U_1 = 1, V_1 = P = 1, Q^1 = Q
+    auto u {one};
+    auto v {one};
+    auto qk {q_mont};
+
+    for (int bit {bit_width(d) - 2}; bit >= 0; --bit)
+    {
+        // U_2k = U_k * V_k, V_2k = V_k^2 - 2 * Q^k
+        u = ctx.mul(u, v);
+        v = ctx.sub(ctx.sqr(v), ctx.add(qk, qk));
+        qk = ctx.sqr(qk);
+
+        if (((d >> bit).low & 1U) == 1U)
+        {
+            // U_k+1 = (P * U_k + V_k) / 2, V_k+1 = (D * U_k + P * V_k) / 2
+            const auto new_u {half_mod(ctx.add(u, v), n)};
+            v = half_mod(ctx.add(ctx.mul(d_mont, u), v), n);
+            u = new_u;
+            qk = ctx.mul(qk, q_mont);
+        }
+    }
+
+    if (u == 0U || v == 0U)
+    {
+        return true;
+    }
+
+    for (int r {1}; r < s; ++r)
+    {
+        v = ctx.sub(ctx.sqr(v), ctx.add(qk, qk));
+        qk = ctx.sqr(qk);
+
+        if (v == 0U)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace detail
+
+// Baillie-PSW primality test after trial division by the primes below 151.
+// The test is exact for every n < 2^64, and no composite passing it is known above that.
+BOOST_INT128_EXPORT BOOST_INT128_HOST_DEVICE constexpr bool is_prime(const uint128_t n) noexcept
+{
+    if ((n.low & 1U) == 0U)
+    {
+        return n == 2U;
+    }
+    if (n == 1U)
+    {
+        return false;
+    }
+
+    #if !(defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA))
+
+    constexpr uint128_divider products[] {
+        uint128_divider{uint128_t{detail::small_prime_products[0]}},
+        uint128_divider{uint128_t{detail::small_prime_products[1]}},
+        uint128_divider{uint128_t{detail::small_prime_products[2]}}
+    };
+
+    std::size_t i {};
+    for (std::size_t group {}; group < 3U; ++group)
+    {
+        const auto residue {(n % products[group]).low};
+
+        for (; i < detail::small_prime_group_end[group]; ++i)
+        {
+            if (detail::small_primes[i].divides(residue))
+            {
+                return n == detail::small_primes[i].prime;
+            }
+        }
+    }
+
+    if (n < detail::small_prime_trial_limit)
+    {
+        return true;
+    }
+
+    #endif
+
+    const montgomery128 ctx {n};
+
+    return detail::is_strong_probable_prime_base_2(ctx) && detail::is_strong_lucas_probable_prime(ctx);
+}
+
+#if !(defined(__CUDACC__) && defined(BOOST_INT128_ENABLE_CUDA))
+
+// Factorization is host only since it relies on std::vector and std::sort
+namespace detail {
+
+// Montgomery arithmetic for odd one word moduli with R = 2^64, the counterpart of montgomery128
+// for cofactors that fit into a single word. Only what the rho iteration needs is provided
+class montgomery64
+{
+private:
+
+    std::uint64_t modulus_ {};
+    std::uint64_t neg_inverse_ {};
+
+public:
+
+    BOOST_INT128_HOST_DEVICE explicit constexpr montgomery64(const std::uint64_t modulus) noexcept :
+        modulus_ {modulus}, neg_inverse_ {0U - inverse_mod_2_64(modulus)} {}
+
+    BOOST_INT128_HOST_DEVICE constexpr std::uint64_t modulus() const noexcept { return modulus_; }
+
+    BOOST_INT128_HOST_DEVICE constexpr std::uint64_t mul(const std::uint64_t lhs, const std::uint64_t rhs) const noexcept
+    {
+        std::uint64_t t_high {};
+        const auto t_low {umul64(lhs, rhs, t_high)};
+
+        std::uint64_t um_high {};
+        umul64(t_low * neg_inverse_, modulus_, um_high);
+
+        const auto partial {t_high + um_high};
+        const auto result {partial + static_cast<std::uint64_t>(t_low != 0U)};
+        const auto overflow {partial < t_high || result < partial};
+
+        return (overflow || result >= modulus_) ? result - modulus_ : result;
+    }
+
+    BOOST_INT128_HOST_DEVICE constexpr std::uint64_t sqr(const std::uint64_t x) const noexcept
+    {
+        return mul(x, x);
+    }
+
+    BOOST_INT128_HOST_DEVICE constexpr std::uint64_t add(const std::uint64_t lhs, const std::uint64_t rhs) const noexcept
+    {
+        const auto sum {lhs + rhs};
+        return (sum < lhs || sum >= modulus_) ? sum - modulus_ : sum;
+    }
+
+    BOOST_INT128_HOST_DEVICE constexpr std::uint64_t sub(const std::uint64_t lhs, const std::uint64_t rhs) const noexcept
+    {
+        return lhs < rhs ? lhs - rhs + modulus_ : lhs - rhs;
+    }
+};
+
+BOOST_INT128_HOST_DEVICE constexpr std::uint64_t rho_gcd(const std::uint64_t a, const std::uint64_t b) noexcept
+{
+    return gcd64(a, b);
+}
+
+BOOST_INT128_HOST_DEVICE constexpr uint128_t rho_gcd(const uint128_t a, const uint128_t b) noexcept
+{
+    return gcd(a, b);
+}
+
+// Pollard's rho with Brent's cycle detection for an odd composite modulus, iterating x <- x^2 + c.
+// The differences are accumulated into batches of products so that only one gcd is taken per batch.
+// Returns a non-trivial factor, or the modulus itself when this choice of c fails.
+// The iteration is done on Montgomery representations, which only changes the constant of the polynomial
+//
+// See: Richard P. Brent, An Improved Monte Carlo Factorization Algorithm, BIT 20 (1980)
+template <typename Context, typename T>
+BOOST_INT128_HOST_DEVICE constexpr T pollard_brent(const Context& ctx, const T c) noexcept
+{
+    constexpr std::uint64_t batch_size {128};
+
+    const auto n {ctx.modulus()};
+
+    T y {2};
+    T x {y};
+    T ys {y};
+    T q {1};
+    T g {1};
+    std::uint64_t r {1};
+
+    do
+    {
+        x = y;
+        for (std::uint64_t i {}; i < r; ++i)
+        {
+            y = ctx.add(ctx.sqr(y), c);
+        }
+
+        std::uint64_t k {};
+        do
+        {
+            ys = y;
+            const auto limit {batch_size < r - k ? batch_size : r - k};
+
+            for (std::uint64_t i {}; i < limit; ++i)
+            {
+                y = ctx.add(ctx.sqr(y), c);
+                q = ctx.mul(q, ctx.sub(x, y));
+            }
+
+            g = rho_gcd(q, n);
+            k += batch_size;
+        } while (k < r && g == 1U);
+
+        r *= 2U;
+    } while (g == 1U);
+
+    if (g == n)
+    {
+        // The batch overshot, so step through it again one gcd at a time
+        do
+        {
+            ys = ctx.add(ctx.sqr(ys), c);
+            g = rho_gcd(ctx.sub(x, ys), n);
+        } while (g == 1U);
+    }
+
+    return g;
+}
+
+// A non-trivial factor of the odd composite n, which has no factor in small_primes and is not a perfect square
+inline uint128_t find_factor(const uint128_t n) noexcept
+{
+    for (std::uint64_t c {1}; ; ++c)
+    {
+        if (n.high == 0U)
+        {
+            // Once the cofactor fits into one word the rho iteration and gcd can use single word arithmetic
+            const montgomery64 ctx {n.low};
+            const auto g {pollard_brent(ctx, c)};
+            if (g != n.low)
+            {
+                return uint128_t{g};
+            }
+        }
+        else
+        {
+            const montgomery128 ctx {n};
+            const auto g {pollard_brent(ctx, uint128_t{c})};
+            if (g != n)
+            {
+                return g;
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+// The prime factorization of n in ascending order, with each prime repeated according to its multiplicity.
+// Returns an empty vector for n == 0 and n == 1.
+//
+// Trial division removes the primes below 151, then composite cofactors are split with Pollard-Brent rho.
+// The running time grows with the square root of the second largest prime factor,
+// so values built from two primes of roughly 64 bits each are out of reach.
+BOOST_INT128_EXPORT inline std::vector<uint128_t> factorize(uint128_t n)
+{
+    std::vector<uint128_t> factors;
+
+    if (n == 0U)
+    {
+        return factors;
+    }
+
+    const auto twos {countr_zero(n)};
+    factors.insert(factors.end(), static_cast<std::size_t>(twos), uint128_t{2});
+    n >>= twos;
+
+    for (const auto& p : detail::small_primes)
+    {
+        while (p.prime <= n && n % p.prime == 0U)
+        {
+            factors.emplace_back(p.prime);
+            n /= p.prime;
+        }
+    }
+
+    std::vector<uint128_t> pending;
+    if (n != 1U)
+    {
+        pending.emplace_back(n);
+    }
+
+    while (!pending.empty())
+    {
+        const auto m {pending.back()};
+        pending.pop_back();
+
+        if (is_prime(m))
+        {
+            factors.emplace_back(m);
+            continue;
+        }
+
+        // Rho needs on the order of sqrt(p) steps, so squares of large primes are split directly
+        const auto root {isqrt(m)};
+        if (root * root == m)
+        {
+            pending.emplace_back(root);
+            pending.emplace_back(root);
+            continue;
+        }
+
+        const auto d {detail::find_factor(m)};
+        pending.emplace_back(d);
+        pending.emplace_back(m / d);
+    }
+
+    std::sort(factors.begin(), factors.end());
+
+    return factors;
+}
+
+#endif // __NVCC__
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_PRIMES_HPP
@@ -6,6 +6,7 @@
 #define BOOST_INT128_STRING_HPP
 
 #include <boost/int128/int128.hpp>
+#include <boost/int128/int256.hpp>
 #include <boost/int128/detail/mini_to_chars.hpp>
 
 #ifndef BOOST_INT128_BUILD_MODULE
@@ -18,11 +19,14 @@ namespace boost {
 namespace int128 {
 
 template <typename T>
-auto to_string(const T& value) -> std::enable_if_t<(std::is_same<T, int128_t>::value || std::is_same<T, uint128_t>::value), std::string>
+auto to_string(const T& value) -> std::enable_if_t<(std::is_same<T, int128_t>::value || std::is_same<T, uint128_t>::value ||
+                                                    std::is_same<T, int256_t>::value || std::is_same<T, uint256_t>::value), std::string>
 {
-    char buffer[64];
+    char buffer[sizeof(T) * 4U];
     const auto last {detail::mini_to_chars(buffer, value, 10, false)};
-    return std::string{last, buffer + sizeof(buffer)};
+
+    // The buffer ends with the null terminator
+    return std::string{last, buffer + sizeof(buffer) - 1U};
 }
 
 } // namespace int128